@@ -0,0 +1,66 @@
+#include "dictionaryloader.h"
+
+/**
+ * @brief Constructs a loader
+ * @param parent The parent object
+ *
+ * Registers the game handle type so it can travel through queued signals.
+ */
+DictionaryLoader::DictionaryLoader(QObject *parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<std::shared_ptr<WordLadderGame>>();
+}
+
+/**
+ * @brief Loads a dictionary and builds its graph
+ * @param requestId Identifies the request in the signals it emits
+ * @param path The path to the dictionary file
+ * @param wordLength The length of the words to keep; lines of other lengths are skipped
+ * @param strategy The search strategy of the new game
+ * @param cancelFlag Raised by the requester to abort the request
+ *
+ * A request cancelled while still queued returns without opening the file.
+ * Progress reports come from the game's callback on this thread and are
+ * forwarded as signals; the game only reports a few dozen times per load,
+ * so the GUI event queue is not flooded.
+ *
+ * Landmark tables are placed here whatever the strategy, so selecting A*
+ * later on the GUI thread only switches the strategy. The ladder length
+ * index is seeded here as well, so play mode can check a requested length
+ * against the longest ladder without searching.
+ */
+void DictionaryLoader::load(quint64 requestId, const QString& path, int wordLength,
+                            WordLadderGame::SearchStrategy strategy, std::shared_ptr<std::atomic<bool>> cancelFlag) {
+    if (cancelFlag->load()) {
+        emit cancelled(requestId);
+        return;
+    }
+
+    auto game = std::make_shared<WordLadderGame>();
+    game->setSearchStrategy(strategy);
+    game->setCancelFlag(cancelFlag.get());
+    game->setProgressCallback([this, requestId](const WordLadderGame::BuildProgress& report) {
+        emit progress(requestId, report.wordsRead, report.edgesFound, report.percent);
+    });
+
+    const bool ok = game->loadDictionaryWithCache(path.toStdString(), wordLength);
+    if (ok && !game->wasCancelled()) {
+        if (game->getLandmarks().empty()) {
+            game->precomputeLandmarks(WordLadderGame::defaultLandmarkCount);
+        }
+        game->getLongestLadder(); // Seeds the ladder length index for play mode
+    }
+
+    // The game outlives this call; drop the references to the request state
+    game->setProgressCallback(nullptr);
+    game->setCancelFlag(nullptr);
+
+    if (game->wasCancelled() || cancelFlag->load()) {
+        emit cancelled(requestId);
+    } else if (!ok) {
+        emit failed(requestId, path);
+    } else {
+        emit loaded(requestId, game);
+    }
+}
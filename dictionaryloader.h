@@ -0,0 +1,82 @@
+#ifndef DICTIONARYLOADER_H
+#define DICTIONARYLOADER_H
+
+#include <QObject>
+#include <QString>
+#include <QMetaType>
+#include <atomic>
+#include <memory>
+#include "wordladdergame.h"
+
+/**
+ * @class DictionaryLoader
+ * @brief Loads dictionaries and builds their graphs on a worker thread
+ *
+ * Lives on its own QThread. Each request builds a fresh WordLadderGame, so
+ * the game the window is using is never touched while loading; the finished
+ * game is handed back through the loaded signal and swapped in by the
+ * receiver. Requests run in the order they were made, and every request
+ * carries a cancel flag that the requester raises when a newer request
+ * supersedes it. All signals are delivered to the GUI thread as queued
+ * signals.
+ */
+class DictionaryLoader : public QObject {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructs a loader
+     * @param parent The parent object; must be null if the loader is moved to a thread
+     */
+    explicit DictionaryLoader(QObject *parent = nullptr);
+
+    /**
+     * @brief Loads a dictionary and builds its graph
+     * @param requestId Identifies the request in the signals it emits
+     * @param path The path to the dictionary file
+     * @param wordLength The length of the words to keep; lines of other lengths are skipped
+     * @param strategy The search strategy of the new game
+     * @param cancelFlag Raised by the requester to abort the request
+     *
+     * Emits progress while working, then exactly one of loaded, failed or
+     * cancelled. The landmark tables for A* are always built, so the game can
+     * switch strategies without searching. Must be invoked on the loader's
+     * thread.
+     */
+    void load(quint64 requestId, const QString& path, int wordLength, WordLadderGame::SearchStrategy strategy,
+              std::shared_ptr<std::atomic<bool>> cancelFlag);
+
+signals:
+    /**
+     * @brief Reports the progress of a request
+     * @param requestId The request being worked on
+     * @param wordsRead Words accepted from the dictionary so far
+     * @param edgesFound Edges found by the graph build so far
+     * @param percent Overall completion, 0 to 100
+     */
+    void progress(quint64 requestId, qulonglong wordsRead, qulonglong edgesFound, int percent);
+
+    /**
+     * @brief Hands over the game of a finished request
+     * @param requestId The finished request
+     * @param game The game with its dictionary and graph ready
+     */
+    void loaded(quint64 requestId, std::shared_ptr<WordLadderGame> game);
+
+    /**
+     * @brief Reports that a dictionary could not be loaded
+     * @param requestId The failed request
+     * @param path The path of the dictionary file
+     */
+    void failed(quint64 requestId, const QString& path);
+
+    /**
+     * @brief Reports that a request was aborted by its cancel flag
+     * @param requestId The cancelled request
+     */
+    void cancelled(quint64 requestId);
+};
+
+Q_DECLARE_METATYPE(std::shared_ptr<WordLadderGame>)
+
+#endif // DICTIONARYLOADER_H
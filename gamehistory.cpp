@@ -0,0 +1,495 @@
+#include "gamehistory.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace {
+
+const char logMagic[8] = {'W', 'L', 'H', 'I', 'S', 'T', '\0', '\0'};
+const char indexMagic[8] = {'W', 'L', 'H', 'I', 'D', 'X', '\0', '\0'};
+constexpr std::uint32_t formatVersion = 1; ///< Bumped whenever either file layout changes
+
+/**
+ * @struct LogHeader
+ * @brief Fixed-size header at the start of the log
+ */
+struct LogHeader {
+    char magic[8];          ///< logMagic
+    std::uint32_t version;  ///< formatVersion at creation time
+    std::uint32_t reserved; ///< Zero
+};
+
+/**
+ * @struct RecordHeader
+ * @brief Fixed-size part of a log record
+ *
+ * Followed by the start word, the target word and the path words, each
+ * wordLength bytes, and then by the record size again as a trailer.
+ */
+struct RecordHeader {
+    std::uint32_t size;         ///< Bytes of the whole record, trailer included
+    std::uint32_t pathLength;   ///< Words in the path
+    std::int64_t playedAt;      ///< Start time in seconds since the Unix epoch
+    std::int32_t optimalMoves;  ///< Moves of the shortest ladder
+    std::int32_t hintsUsed;     ///< Hints requested
+    std::uint32_t wordLength;   ///< Length of every word of the game
+    std::uint32_t reserved;     ///< Zero
+};
+
+/**
+ * @struct IndexHeader
+ * @brief Header of the index, followed by uniqueWords packed keys
+ */
+struct IndexHeader {
+    char magic[8];                   ///< indexMagic
+    std::uint32_t version;           ///< formatVersion at write time
+    std::uint32_t reserved;          ///< Zero
+    std::uint64_t logBytes;          ///< Log bytes the totals cover
+    std::uint64_t games;             ///< Games played
+    std::uint64_t totalMoves;        ///< Moves made by the player
+    std::uint64_t totalOptimalMoves; ///< Moves of the shortest ladders
+    std::uint64_t totalHints;        ///< Hints used
+    std::uint64_t uniqueWords;       ///< Number of keys after the header
+};
+
+constexpr std::uint32_t trailerSize = sizeof(std::uint32_t);
+constexpr std::uint32_t minRecordSize = sizeof(RecordHeader) + trailerSize;
+
+/**
+ * @brief Reads the index header if the file holds one
+ * @param path The index file
+ * @param header Receives the header
+ * @return true if the file starts with a header of the current version
+ */
+bool readIndexHeader(const std::string& path, IndexHeader& header) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        return false;
+    }
+    return std::memcmp(header.magic, indexMagic, sizeof(indexMagic)) == 0 && header.version == formatVersion;
+}
+
+/**
+ * @brief Decodes one record
+ * @param data The record bytes, starting at its header
+ * @param size The record size taken from its framing
+ * @param record Receives the game
+ * @return true if the header, the words and the trailer agree with size
+ */
+bool decodeRecord(const char* data, std::uint32_t size, GameRecord& record) {
+    RecordHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    const std::uint64_t words = static_cast<std::uint64_t>(header.pathLength) + 2;
+    std::uint32_t trailer;
+    std::memcpy(&trailer, data + size - trailerSize, trailerSize);
+    if (header.size != size || trailer != size
+        || minRecordSize + words * header.wordLength != size) {
+        return false;
+    }
+
+    const char* word = data + sizeof(RecordHeader);
+    record.playedAt = header.playedAt;
+    record.optimalMoves = header.optimalMoves;
+    record.hintsUsed = header.hintsUsed;
+    record.startWord.assign(word, header.wordLength);
+    word += header.wordLength;
+    record.targetWord.assign(word, header.wordLength);
+    word += header.wordLength;
+    record.path.clear();
+    record.path.reserve(header.pathLength);
+    for (std::uint32_t i = 0; i < header.pathLength; ++i, word += header.wordLength) {
+        record.path.emplace_back(word, header.wordLength);
+    }
+    return true;
+}
+
+/**
+ * @brief Reads and decodes the record at a log offset
+ * @param in The open log
+ * @param offset Start of the record
+ * @param size The record size taken from its framing
+ * @param buffer Scratch space for the record bytes
+ * @param record Receives the game
+ * @return true if the whole record was read and is well formed
+ */
+bool readRecord(std::ifstream& in, std::uint64_t offset, std::uint32_t size,
+                std::vector<char>& buffer, GameRecord& record) {
+    if (size < minRecordSize) {
+        return false;
+    }
+    buffer.resize(size);
+    in.clear();
+    in.seekg(static_cast<std::streamoff>(offset));
+    return in.read(buffer.data(), size) && decodeRecord(buffer.data(), size, record);
+}
+
+/**
+ * @brief Formats a Unix time as an ISO 8601 UTC timestamp
+ * @param seconds Seconds since the Unix epoch
+ * @return The time as "YYYY-MM-DDTHH:MM:SSZ"
+ *
+ * Converts the day count to a civil date arithmetically (400-year eras of
+ * the proleptic Gregorian calendar), so no thread-unsafe gmtime is needed.
+ */
+std::string formatTimestamp(std::int64_t seconds) {
+    std::int64_t days = seconds / 86400;
+    std::int64_t secondOfDay = seconds % 86400;
+    if (secondOfDay < 0) {
+        secondOfDay += 86400;
+        --days;
+    }
+    days += 719468; // Shift the epoch to 0000-03-01
+    const std::int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const std::int64_t dayOfEra = days - era * 146097;
+    const std::int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const std::int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const std::int64_t monthIndex = (5 * dayOfYear + 2) / 153;
+    const int day = static_cast<int>(dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+    const int month = static_cast<int>(monthIndex < 10 ? monthIndex + 3 : monthIndex - 9);
+    const long long year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+
+    char text[40];
+    std::snprintf(text, sizeof(text), "%04lld-%02d-%02dT%02d:%02d:%02dZ", year, month, day,
+                  static_cast<int>(secondOfDay / 3600), static_cast<int>(secondOfDay / 60 % 60),
+                  static_cast<int>(secondOfDay % 60));
+    return text;
+}
+
+} // namespace
+
+/**
+ * @brief Gets the log file path for a player
+ * @param playerName The player name, already restricted to file-safe characters
+ * @return The path of the player's history log
+ */
+std::string GameHistory::pathFor(const std::string& playerName) {
+    return playerName + ".wlhist";
+}
+
+/**
+ * @brief Attaches a log file and loads its summary
+ * @param logPath The log file; it is created by the first append if missing
+ * @return true if the log is absent or a valid history log
+ *
+ * Reads the log header and the index header only. When the index covers
+ * less than the log, the missing records are counted and the index is
+ * rewritten; when it is missing, damaged or claims more than the log holds,
+ * it is rebuilt from the whole log.
+ */
+bool GameHistory::open(const std::string& logPath) {
+    this->logPath = logPath;
+    indexPath = logPath + ".idx";
+    totals = Summary();
+    coveredBytes = sizeof(LogHeader);
+    uniqueWords.clear();
+    wordsLoaded = true;
+
+    std::error_code error;
+    const std::uint64_t logSize = std::filesystem::file_size(logPath, error);
+    if (error) {
+        coveredBytes = 0; // No log yet; the first append creates it
+        return !std::filesystem::exists(logPath, error);
+    }
+
+    LogHeader logHeader;
+    std::ifstream in(logPath, std::ios::binary);
+    if (!in.read(reinterpret_cast<char*>(&logHeader), sizeof(logHeader))
+        || std::memcmp(logHeader.magic, logMagic, sizeof(logMagic)) != 0
+        || logHeader.version != formatVersion) {
+        coveredBytes = 0;
+        return false;
+    }
+    in.close();
+
+    IndexHeader indexHeader;
+    if (readIndexHeader(indexPath, indexHeader)
+        && indexHeader.logBytes >= sizeof(LogHeader) && indexHeader.logBytes <= logSize) {
+        totals.games = indexHeader.games;
+        totals.totalMoves = indexHeader.totalMoves;
+        totals.totalOptimalMoves = indexHeader.totalOptimalMoves;
+        totals.totalHints = indexHeader.totalHints;
+        totals.uniqueWords = indexHeader.uniqueWords;
+        coveredBytes = indexHeader.logBytes;
+        wordsLoaded = false;
+    }
+    if (coveredBytes == logSize) {
+        return true;
+    }
+
+    if (!wordsLoaded && !loadUniqueWords()) {
+        totals = Summary();
+        coveredBytes = sizeof(LogHeader);
+        uniqueWords.clear();
+        wordsLoaded = true;
+    }
+    catchUp();
+    writeIndex();
+    return true;
+}
+
+/**
+ * @brief Appends one game to the log and updates the index
+ * @param record The finished game
+ * @return true if both files were written
+ *
+ * Every word of the game must have the same length. A torn record left at
+ * the end of the log by an interrupted write is cut off first, so the new
+ * record always follows the last complete one. The index is rewritten
+ * under a temporary name and renamed into place.
+ */
+bool GameHistory::append(const GameRecord& record) {
+    const size_t wordLength = record.startWord.length();
+    if (logPath.empty() || record.targetWord.length() != wordLength
+        || std::any_of(record.path.begin(), record.path.end(),
+                       [&](const std::string& word) { return word.length() != wordLength; })) {
+        return false;
+    }
+    if (!wordsLoaded && !loadUniqueWords()) {
+        totals = Summary();
+        coveredBytes = sizeof(LogHeader);
+        uniqueWords.clear();
+        wordsLoaded = true;
+        catchUp();
+    }
+
+    std::error_code error;
+    if (coveredBytes == 0) {
+        LogHeader header{};
+        std::memcpy(header.magic, logMagic, sizeof(logMagic));
+        header.version = formatVersion;
+        std::ofstream out(logPath, std::ios::binary | std::ios::trunc);
+        if (!out.write(reinterpret_cast<const char*>(&header), sizeof(header))) {
+            return false;
+        }
+        coveredBytes = sizeof(header);
+    } else if (std::filesystem::file_size(logPath, error) != coveredBytes) {
+        std::filesystem::resize_file(logPath, coveredBytes, error);
+        if (error) {
+            return false;
+        }
+    }
+
+    RecordHeader header{};
+    header.size = static_cast<std::uint32_t>(minRecordSize + (record.path.size() + 2) * wordLength);
+    header.pathLength = static_cast<std::uint32_t>(record.path.size());
+    header.playedAt = record.playedAt;
+    header.optimalMoves = record.optimalMoves;
+    header.hintsUsed = record.hintsUsed;
+    header.wordLength = static_cast<std::uint32_t>(wordLength);
+
+    std::vector<char> bytes(header.size);
+    char* cursor = bytes.data();
+    std::memcpy(cursor, &header, sizeof(header));
+    cursor += sizeof(header);
+    std::memcpy(cursor, record.startWord.data(), wordLength);
+    cursor += wordLength;
+    std::memcpy(cursor, record.targetWord.data(), wordLength);
+    cursor += wordLength;
+    for (const std::string& word : record.path) {
+        std::memcpy(cursor, word.data(), wordLength);
+        cursor += wordLength;
+    }
+    std::memcpy(cursor, &header.size, trailerSize);
+
+    {
+        std::ofstream out(logPath, std::ios::binary | std::ios::app);
+        if (!out.write(bytes.data(), static_cast<std::streamsize>(bytes.size())) || !out.flush()) {
+            return false;
+        }
+    }
+    count(record);
+    coveredBytes += header.size;
+    return writeIndex();
+}
+
+/**
+ * @brief Reads the most recent games
+ * @param count The maximum number of games to read
+ * @return Up to count games, oldest first
+ *
+ * Walks the log backwards from the last covered record using the size
+ * trailers, so only the returned records are read.
+ */
+std::vector<GameRecord> GameHistory::recent(size_t count) const {
+    std::vector<GameRecord> records;
+    std::ifstream in(logPath, std::ios::binary);
+    if (!in.is_open() || coveredBytes <= sizeof(LogHeader)) {
+        return records;
+    }
+
+    std::vector<char> buffer;
+    std::uint64_t end = coveredBytes;
+    while (records.size() < count && end > sizeof(LogHeader)) {
+        std::uint32_t size = 0;
+        in.clear();
+        in.seekg(static_cast<std::streamoff>(end - trailerSize));
+        if (!in.read(reinterpret_cast<char*>(&size), trailerSize) || size > end - sizeof(LogHeader)) {
+            break;
+        }
+        GameRecord record;
+        if (!readRecord(in, end - size, size, buffer, record)) {
+            break;
+        }
+        records.push_back(std::move(record));
+        end -= size;
+    }
+    std::reverse(records.begin(), records.end());
+    return records;
+}
+
+/**
+ * @brief Writes every game to a CSV file
+ * @param csvPath The file to write
+ * @return true if the file was written completely
+ *
+ * Streams the log one record at a time. The columns are the start time in
+ * UTC, the start and target words, the moves made, the optimal moves, the
+ * hints used and the path with its words joined by " -> ".
+ */
+bool GameHistory::exportCsv(const std::string& csvPath) const {
+    std::ofstream out(csvPath, std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+    out << "DateTime,StartWord,TargetWord,UserMovesCount,OptimalMoves,HintsUsed,UserPath\n";
+
+    std::ifstream in(logPath, std::ios::binary);
+    std::vector<char> buffer;
+    GameRecord record;
+    for (std::uint64_t offset = sizeof(LogHeader); in.is_open() && offset < coveredBytes; ) {
+        std::uint32_t size = 0;
+        in.clear();
+        in.seekg(static_cast<std::streamoff>(offset));
+        if (!in.read(reinterpret_cast<char*>(&size), sizeof(size))
+            || !readRecord(in, offset, size, buffer, record)) {
+            return false;
+        }
+        out << formatTimestamp(record.playedAt) << ',' << record.startWord << ',' << record.targetWord << ','
+            << record.moves() << ',' << record.optimalMoves << ',' << record.hintsUsed << ',';
+        for (size_t i = 0; i < record.path.size(); ++i) {
+            out << (i > 0 ? " -> " : "") << record.path[i];
+        }
+        out << '\n';
+        offset += size;
+    }
+    return out.good();
+}
+
+/**
+ * @brief Reads the unique word set stored after the index header
+ * @return true if the index held a set matching its header
+ *
+ * Only needed before counting new games; showing the totals never reads
+ * past the header.
+ */
+bool GameHistory::loadUniqueWords() {
+    IndexHeader header;
+    std::ifstream in(indexPath, std::ios::binary);
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || std::memcmp(header.magic, indexMagic, sizeof(indexMagic)) != 0
+        || header.version != formatVersion || header.uniqueWords != totals.uniqueWords) {
+        return false;
+    }
+    uniqueWords.resize(header.uniqueWords);
+    if (!in.read(reinterpret_cast<char*>(uniqueWords.data()),
+                 static_cast<std::streamsize>(uniqueWords.size() * sizeof(PackedWord::Key)))) {
+        uniqueWords.clear();
+        return false;
+    }
+    wordsLoaded = true;
+    return true;
+}
+
+/**
+ * @brief Adds the records the index has not seen yet
+ * @return true if the log could be read
+ *
+ * Stops at the first record that is incomplete or malformed; the bytes from
+ * there on are not covered and are cut off by the next append.
+ */
+bool GameHistory::catchUp() {
+    std::ifstream in(logPath, std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+    in.seekg(0, std::ios::end);
+    const std::uint64_t logSize = static_cast<std::uint64_t>(in.tellg());
+
+    std::vector<char> buffer;
+    GameRecord record;
+    while (coveredBytes + minRecordSize <= logSize) {
+        std::uint32_t size = 0;
+        in.clear();
+        in.seekg(static_cast<std::streamoff>(coveredBytes));
+        if (!in.read(reinterpret_cast<char*>(&size), sizeof(size)) || size > logSize - coveredBytes
+            || !readRecord(in, coveredBytes, size, buffer, record)) {
+            break;
+        }
+        count(record);
+        coveredBytes += size;
+    }
+    return true;
+}
+
+/**
+ * @brief Adds one record to the totals and the word set
+ * @param record The game to count
+ */
+void GameHistory::count(const GameRecord& record) {
+    ++totals.games;
+    totals.totalMoves += static_cast<std::uint64_t>(record.moves());
+    totals.totalOptimalMoves += static_cast<std::uint64_t>(std::max(0, record.optimalMoves));
+    totals.totalHints += static_cast<std::uint64_t>(std::max(0, record.hintsUsed));
+    for (const std::string& word : record.path) {
+        PackedWord::Key key;
+        if (!PackedWord::pack(word, key)) {
+            continue;
+        }
+        const auto slot = std::lower_bound(uniqueWords.begin(), uniqueWords.end(), key);
+        if (slot == uniqueWords.end() || *slot != key) {
+            uniqueWords.insert(slot, key);
+        }
+    }
+    totals.uniqueWords = uniqueWords.size();
+}
+
+/**
+ * @brief Rewrites the index from the totals and the word set
+ * @return true if the index was written
+ */
+bool GameHistory::writeIndex() const {
+    IndexHeader header{};
+    std::memcpy(header.magic, indexMagic, sizeof(indexMagic));
+    header.version = formatVersion;
+    header.logBytes = coveredBytes;
+    header.games = totals.games;
+    header.totalMoves = totals.totalMoves;
+    header.totalOptimalMoves = totals.totalOptimalMoves;
+    header.totalHints = totals.totalHints;
+    header.uniqueWords = uniqueWords.size();
+
+    const std::string temporaryPath = indexPath + ".tmp";
+    {
+        std::ofstream out(temporaryPath, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(uniqueWords.data()),
+                  static_cast<std::streamsize>(uniqueWords.size() * sizeof(PackedWord::Key)));
+        if (!out.good()) {
+            out.close();
+            std::error_code error;
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, indexPath, error);
+    if (error) {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,140 @@
+#ifndef GAMEHISTORY_H
+#define GAMEHISTORY_H
+
+#include "packedword.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct GameRecord
+ * @brief One finished play mode game
+ */
+struct GameRecord {
+    std::int64_t playedAt = 0;        ///< Start time, in seconds since the Unix epoch (UTC)
+    std::string startWord;            ///< The starting word
+    std::string targetWord;           ///< The target word
+    std::vector<std::string> path;    ///< Every word the player went through, start first
+    int optimalMoves = 0;             ///< Moves of the shortest ladder
+    int hintsUsed = 0;                ///< Hints requested during the game
+
+    /**
+     * @brief Gets the number of moves the player made
+     * @return The path length minus the starting word
+     */
+    int moves() const { return path.empty() ? 0 : static_cast<int>(path.size()) - 1; }
+};
+
+/**
+ * @class GameHistory
+ * @brief Append-only binary log of a player's games with a summary index
+ *
+ * The log ("alice.wlhist") holds one variable-size record per game, each
+ * framed by its size at both ends so it can be walked forwards for export
+ * and backwards to read the most recent games. Records are only ever
+ * appended, so saving a game writes one record and never rewrites history.
+ *
+ * The index ("alice.wlhist.idx") keeps the running totals and the sorted
+ * packed keys of every word the player has used, together with the log size
+ * they cover. Opening a history reads only the index header, so the totals
+ * cost the same however many games were played. An index that is missing
+ * or behind the log (say after a crash between the two writes) is brought
+ * up to date from the records it has not seen; a torn record at the end of
+ * the log is dropped before the next append.
+ *
+ * Both files are written in host byte order, like the graph cache.
+ */
+class GameHistory {
+public:
+    /**
+     * @struct Summary
+     * @brief Totals over every game in the log
+     */
+    struct Summary {
+        std::uint64_t games = 0;             ///< Games played
+        std::uint64_t totalMoves = 0;        ///< Moves made by the player
+        std::uint64_t totalOptimalMoves = 0; ///< Moves of the shortest ladders
+        std::uint64_t totalHints = 0;        ///< Hints used
+        std::uint64_t uniqueWords = 0;       ///< Different words the player went through
+    };
+
+    /**
+     * @brief Gets the log file path for a player
+     * @param playerName The player name, already restricted to file-safe characters
+     * @return The path of the player's history log
+     */
+    static std::string pathFor(const std::string& playerName);
+
+    /**
+     * @brief Constructs a history with no log attached
+     */
+    GameHistory() = default;
+
+    /**
+     * @brief Attaches a log file and loads its summary
+     * @param logPath The log file; it is created by the first append if missing
+     * @return true if the log is absent or a valid history log
+     */
+    bool open(const std::string& logPath);
+
+    /**
+     * @brief Gets the totals over every game
+     * @return The summary read from the index
+     */
+    const Summary& summary() const { return totals; }
+
+    /**
+     * @brief Appends one game to the log and updates the index
+     * @param record The finished game
+     * @return true if both files were written
+     */
+    bool append(const GameRecord& record);
+
+    /**
+     * @brief Reads the most recent games
+     * @param count The maximum number of games to read
+     * @return Up to count games, oldest first
+     */
+    std::vector<GameRecord> recent(size_t count) const;
+
+    /**
+     * @brief Writes every game to a CSV file
+     * @param csvPath The file to write
+     * @return true if the file was written completely
+     */
+    bool exportCsv(const std::string& csvPath) const;
+
+private:
+    /**
+     * @brief Reads the unique word set stored after the index header
+     * @return true if the index held a set matching its header
+     */
+    bool loadUniqueWords();
+
+    /**
+     * @brief Adds the records the index has not seen yet
+     * @return true if the log could be read
+     */
+    bool catchUp();
+
+    /**
+     * @brief Adds one record to the totals and the word set
+     * @param record The game to count
+     */
+    void count(const GameRecord& record);
+
+    /**
+     * @brief Rewrites the index from the totals and the word set
+     * @return true if the index was written
+     */
+    bool writeIndex() const;
+
+    std::string logPath;                       ///< The log file
+    std::string indexPath;                     ///< The index file
+    Summary totals;                            ///< Totals over the covered records
+    std::uint64_t coveredBytes = 0;            ///< Log bytes reflected in totals
+    std::vector<PackedWord::Key> uniqueWords;  ///< Sorted keys of the used words, loaded on first append
+    bool wordsLoaded = false;                  ///< Whether uniqueWords holds the full set
+};
+
+#endif // GAMEHISTORY_H
@@ -5,6 +5,10 @@
 #include <vector>
 #include <string>
 #include <set> // For getNodes if ensuring unique nodes in return list is desired or for alternative adjList
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
 
 /**
  * @class Graph
@@ -129,4 +133,345 @@ public:
     }
 };
 
+/**
+ * @class CompactGraph
+ * @brief A frozen, read-only graph in compressed sparse row (CSR) form
+ *
+ * Nodes are interned to dense 32-bit IDs in sorted order. The adjacency of
+ * node i is the slice neighbors[offsets[i] .. offsets[i + 1]), so an edge
+ * costs 4 bytes and a neighbor lookup is one array slice with no tree walk.
+ *
+ * The graph is meant to be built in one go, from a Graph<T> or an edge
+ * list, but supports small edits: addNode() appends a node with the next
+ * ID, and setNeighbors() replaces one row. The first edit switches the
+ * graph to an edited layout in which each row also has its own end in
+ * ends[], so a row that shrinks is rewritten in place and a row that grows
+ * is moved to the end of the neighbor array. compact() restores the
+ * canonical layout; getOffsets() and getNeighborArray() describe the graph
+ * only while isCompact() holds.
+ *
+ * @tparam T The type of the nodes in the graph (must be less-than comparable)
+ */
+template <typename T>
+class CompactGraph {
+public:
+    using NodeId = std::uint32_t; ///< Dense node identifier
+    static constexpr NodeId invalidNode = std::numeric_limits<NodeId>::max(); ///< Returned for unknown nodes
+
+    /**
+     * @class NeighborRange
+     * @brief A lightweight view over the neighbor IDs of one node
+     */
+    class NeighborRange {
+    public:
+        NeighborRange(const NodeId* first, const NodeId* last) : first(first), last(last) {}
+        const NodeId* begin() const { return first; }
+        const NodeId* end() const { return last; }
+        size_t size() const { return static_cast<size_t>(last - first); }
+        bool empty() const { return first == last; }
+        NodeId operator[](size_t i) const { return first[i]; }
+
+    private:
+        const NodeId* first;
+        const NodeId* last;
+    };
+
+    /**
+     * @brief Default constructor, creates an empty graph
+     */
+    CompactGraph() : offsets(1, 0), sortedCount(0), liveEntries(0) {}
+
+    /**
+     * @brief Freezes a mutable graph
+     * @param graph The graph to convert
+     *
+     * Node IDs follow the sorted order of the nodes; neighbor order is preserved.
+     */
+    explicit CompactGraph(const Graph<T>& graph)
+        : nodes(graph.getNodes()), offsets(1, 0), sortedCount(nodes.size()), liveEntries(0) {
+        offsets.reserve(nodes.size() + 1);
+        for (const T& node : nodes) {
+            for (const T& neighbor : graph.getNeighbors(node)) {
+                neighbors.push_back(idOf(neighbor));
+            }
+            offsets.push_back(static_cast<NodeId>(neighbors.size()));
+        }
+    }
+
+    /**
+     * @brief Builds an undirected graph from an edge list
+     * @param sortedNodes The nodes, sorted and without duplicates; node i gets ID i
+     * @param edges The undirected edges as pairs of node IDs, each listed once
+     * @return The frozen graph, with every neighbor slice sorted by ID
+     *
+     * Uses a counting pass over the edges, so the adjacency arrays are
+     * allocated exactly once.
+     */
+    static CompactGraph fromEdgeList(std::vector<T> sortedNodes, const std::vector<std::pair<NodeId, NodeId>>& edges) {
+        CompactGraph graph;
+        graph.nodes = std::move(sortedNodes);
+        graph.sortedCount = graph.nodes.size();
+        graph.offsets.assign(graph.nodes.size() + 1, 0);
+
+        // Count degrees, then turn them into slice offsets
+        for (const auto& edge : edges) {
+            ++graph.offsets[edge.first + 1];
+            ++graph.offsets[edge.second + 1];
+        }
+        for (size_t i = 1; i < graph.offsets.size(); ++i) {
+            graph.offsets[i] += graph.offsets[i - 1];
+        }
+
+        // Scatter both directions of every edge into place
+        graph.neighbors.resize(edges.size() * 2);
+        std::vector<NodeId> cursor(graph.offsets.begin(), graph.offsets.end() - 1);
+        for (const auto& edge : edges) {
+            graph.neighbors[cursor[edge.first]++] = edge.second;
+            graph.neighbors[cursor[edge.second]++] = edge.first;
+        }
+        for (size_t i = 0; i < graph.nodes.size(); ++i) {
+            std::sort(graph.neighbors.begin() + graph.offsets[i], graph.neighbors.begin() + graph.offsets[i + 1]);
+        }
+        return graph;
+    }
+
+    /**
+     * @brief Adopts ready-made CSR arrays
+     * @param sortedNodes The nodes, sorted and without duplicates; node i gets ID i
+     * @param offsets Start of each node's slice in neighbors, of size nodeCount + 1
+     * @param neighbors Concatenated neighbor IDs of all nodes
+     * @return The frozen graph, or an empty graph if the arrays are inconsistent
+     *
+     * Used to restore a graph saved with getOffsets() and getNeighborArray().
+     * The arrays are validated so that a damaged source cannot produce
+     * out-of-range slices or neighbor IDs.
+     */
+    static CompactGraph fromArrays(std::vector<T> sortedNodes, std::vector<NodeId> offsets, std::vector<NodeId> neighbors) {
+        CompactGraph graph;
+        if (offsets.size() != sortedNodes.size() + 1 || offsets.front() != 0 || offsets.back() != neighbors.size()) {
+            return graph;
+        }
+        for (size_t i = 1; i < offsets.size(); ++i) {
+            if (offsets[i] < offsets[i - 1]) {
+                return graph;
+            }
+        }
+        for (NodeId neighbor : neighbors) {
+            if (neighbor >= sortedNodes.size()) {
+                return graph;
+            }
+        }
+        graph.nodes = std::move(sortedNodes);
+        graph.sortedCount = graph.nodes.size();
+        graph.offsets = std::move(offsets);
+        graph.neighbors = std::move(neighbors);
+        return graph;
+    }
+
+    /**
+     * @brief Appends a node with no neighbors
+     * @param node The node to add; must not be in the graph yet
+     * @return The ID of the new node, which is the previous nodeCount()
+     *
+     * Existing IDs do not change. Appended nodes are not part of the sorted
+     * node table, so idOf() finds them by a linear scan.
+     */
+    NodeId addNode(const T& node) {
+        const NodeId id = static_cast<NodeId>(nodes.size());
+        nodes.push_back(node);
+        offsets.back() = static_cast<NodeId>(neighbors.size()); // Start of the new, empty row
+        offsets.push_back(static_cast<NodeId>(neighbors.size()));
+        if (!isCompact()) {
+            ends.push_back(static_cast<NodeId>(neighbors.size()));
+        }
+        return id;
+    }
+
+    /**
+     * @brief Replaces the neighbors of one node
+     * @param id A valid node ID
+     * @param ids The new neighbor IDs, each a valid node ID
+     *
+     * Only this row changes; keeping the graph undirected is up to the
+     * caller, who edits the rows at both ends of an edge. The cost is
+     * proportional to the old and new row lengths, plus an occasional
+     * compact() once the space left behind by moved rows outweighs the live
+     * entries.
+     */
+    void setNeighbors(NodeId id, const std::vector<NodeId>& ids) {
+        if (isCompact()) {
+            // Switch to the edited layout: offsets[i] starts row i, ends[i] ends it
+            liveEntries = neighbors.size();
+            ends.assign(offsets.begin() + 1, offsets.end());
+        }
+        const NodeId begin = offsets[id];
+        const NodeId oldSize = ends[id] - begin;
+        liveEntries = liveEntries - oldSize + ids.size();
+        if (ids.size() <= oldSize) {
+            std::copy(ids.begin(), ids.end(), neighbors.begin() + begin);
+            ends[id] = begin + static_cast<NodeId>(ids.size());
+        } else {
+            offsets[id] = static_cast<NodeId>(neighbors.size());
+            neighbors.insert(neighbors.end(), ids.begin(), ids.end());
+            ends[id] = static_cast<NodeId>(neighbors.size());
+        }
+        if (neighbors.size() > 2 * liveEntries + compactionSlack) {
+            compact();
+        }
+    }
+
+    /**
+     * @brief Restores the canonical CSR layout after edits
+     *
+     * Copies every row into a fresh neighbor array in ID order, dropping the
+     * space left behind by edited rows. Linear in the size of the graph.
+     */
+    void compact() {
+        if (isCompact()) {
+            return;
+        }
+        std::vector<NodeId> packed;
+        packed.reserve(liveEntries);
+        std::vector<NodeId> packedOffsets;
+        packedOffsets.reserve(nodes.size() + 1);
+        packedOffsets.push_back(0);
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            packed.insert(packed.end(), neighbors.begin() + offsets[i], neighbors.begin() + ends[i]);
+            packedOffsets.push_back(static_cast<NodeId>(packed.size()));
+        }
+        neighbors.swap(packed);
+        offsets.swap(packedOffsets);
+        std::vector<NodeId>().swap(ends);
+    }
+
+    /**
+     * @brief Checks whether the graph is in the canonical CSR layout
+     * @return true if the graph has not been edited since it was built or compacted
+     */
+    bool isCompact() const {
+        return ends.empty();
+    }
+
+    /**
+     * @brief Looks up the ID of a node
+     * @param node The node to look up
+     * @return The node's ID, or invalidNode if it is not in the graph
+     */
+    NodeId idOf(const T& node) const {
+        const auto sortedEnd = nodes.begin() + sortedCount;
+        auto it = std::lower_bound(nodes.begin(), sortedEnd, node);
+        if (it == sortedEnd || *it != node) {
+            it = std::find(sortedEnd, nodes.end(), node);
+            if (it == nodes.end()) {
+                return invalidNode;
+            }
+        }
+        return static_cast<NodeId>(it - nodes.begin());
+    }
+
+    /**
+     * @brief Checks if a node exists in the graph
+     * @param node The node to check
+     * @return true if the node exists, false otherwise
+     */
+    bool hasNode(const T& node) const {
+        return idOf(node) != invalidNode;
+    }
+
+    /**
+     * @brief Gets the node with a given ID
+     * @param id A valid node ID
+     * @return A const reference to the node
+     */
+    const T& node(NodeId id) const {
+        return nodes[id];
+    }
+
+    /**
+     * @brief Gets the neighbors of a node
+     * @param id A valid node ID
+     * @return A view over the IDs of the node's neighbors
+     */
+    NeighborRange getNeighbors(NodeId id) const {
+        const NodeId* base = neighbors.data();
+        return NeighborRange(base + offsets[id], base + (ends.empty() ? offsets[id + 1] : ends[id]));
+    }
+
+    /**
+     * @brief Gets all nodes in the graph, indexed by ID
+     * @return A const reference to the node table
+     */
+    const std::vector<T>& getNodes() const {
+        return nodes;
+    }
+
+    /**
+     * @brief Gets the slice offsets of the CSR representation
+     * @return The offsets array, of size nodeCount + 1; only meaningful while isCompact()
+     */
+    const std::vector<NodeId>& getOffsets() const {
+        return offsets;
+    }
+
+    /**
+     * @brief Gets the neighbor array of the CSR representation
+     * @return The concatenated neighbor IDs of all nodes; only meaningful while isCompact()
+     */
+    const std::vector<NodeId>& getNeighborArray() const {
+        return neighbors;
+    }
+
+    /**
+     * @brief Gets the number of nodes
+     * @return The number of nodes in the graph
+     */
+    size_t nodeCount() const {
+        return nodes.size();
+    }
+
+    /**
+     * @brief Gets the number of undirected edges
+     * @return The number of edges in the graph
+     */
+    size_t edgeCount() const {
+        return (isCompact() ? neighbors.size() : liveEntries) / 2;
+    }
+
+    /**
+     * @brief Gets the memory held by the graph's arrays
+     * @return The allocated bytes of the node table and CSR arrays
+     *
+     * Heap storage owned by the node values themselves (e.g. long strings)
+     * is not included.
+     */
+    size_t memoryUsage() const {
+        return nodes.capacity() * sizeof(T)
+             + (offsets.capacity() + ends.capacity() + neighbors.capacity()) * sizeof(NodeId);
+    }
+
+    /**
+     * @brief Clears the graph
+     *
+     * Removes all nodes and edges and releases their memory.
+     */
+    void clear() {
+        std::vector<T>().swap(nodes);
+        std::vector<NodeId>(1, 0).swap(offsets);
+        std::vector<NodeId>().swap(neighbors);
+        std::vector<NodeId>().swap(ends);
+        sortedCount = 0;
+        liveEntries = 0;
+    }
+
+private:
+    static constexpr size_t compactionSlack = 4096; ///< Unused neighbor entries always tolerated before compacting
+
+    std::vector<T> nodes;          ///< Node table, sorted up to sortedCount; the index is the node ID
+    std::vector<NodeId> offsets;   ///< Start of each node's slice in neighbors (size nodeCount + 1)
+    std::vector<NodeId> neighbors; ///< Concatenated neighbor IDs of all nodes
+    std::vector<NodeId> ends;      ///< End of each node's slice once edited, empty while compact
+    size_t sortedCount;            ///< Length of the sorted prefix of nodes; the rest were appended
+    size_t liveEntries;            ///< Neighbor entries inside some row, tracked once edited
+};
+
 #endif // GRAPH_H
@@ -0,0 +1,219 @@
+#include "graphcache.h"
+#include "mappedfile.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <system_error>
+
+namespace GraphCache {
+
+namespace {
+
+const char fileMagic[8] = {'W', 'L', 'G', 'R', 'A', 'P', 'H', '\0'};
+
+/**
+ * @struct FileHeader
+ * @brief Fixed-size header at the start of every cache file
+ */
+struct FileHeader {
+    char magic[8];               ///< fileMagic
+    std::uint32_t version;       ///< formatVersion at write time
+    std::uint32_t wordLength;    ///< Length of every word
+    std::uint64_t wordCount;     ///< Number of packed words
+    std::uint64_t neighborCount; ///< Number of CSR neighbor entries
+    std::uint64_t sourceSize;    ///< Size of the dictionary file
+    std::int64_t sourceTime;     ///< Modification time of the dictionary file
+    std::uint64_t checksum;      ///< Hash of everything after the header
+};
+
+/**
+ * @brief Reads the size and modification time of a file
+ * @param path The file to inspect
+ * @param size Receives the size in bytes
+ * @param time Receives the modification time in file clock ticks
+ * @return true if the file exists and could be inspected
+ */
+bool sourceStamp(const std::string& path, std::uint64_t& size, std::int64_t& time) {
+    std::error_code error;
+    const auto fileSize = std::filesystem::file_size(path, error);
+    if (error) {
+        return false;
+    }
+    const auto writeTime = std::filesystem::last_write_time(path, error);
+    if (error) {
+        return false;
+    }
+    size = static_cast<std::uint64_t>(fileSize);
+    time = static_cast<std::int64_t>(writeTime.time_since_epoch().count());
+    return true;
+}
+
+/**
+ * @brief Incremental 64-bit checksum over byte ranges
+ *
+ * Mixes eight bytes per step with a multiply-xor round (FNV-1a style), so
+ * hashing a multi-megabyte payload stays in the low milliseconds.
+ */
+class Checksum {
+public:
+    void add(const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (; size >= 8; bytes += 8, size -= 8) {
+            std::uint64_t word;
+            std::memcpy(&word, bytes, 8);
+            mix(word);
+        }
+        for (; size > 0; ++bytes, --size) {
+            mix(*bytes);
+        }
+    }
+
+    std::uint64_t value() const { return hash; }
+
+private:
+    void mix(std::uint64_t word) {
+        hash ^= word;
+        hash *= 0x100000001b3ULL;
+        hash ^= hash >> 29;
+    }
+
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+};
+
+} // namespace
+
+/**
+ * @brief Gets the cache file path for a dictionary
+ * @param dictionaryPath The path of the dictionary file
+ * @return The path of its cache file
+ */
+std::string cachePathFor(const std::string& dictionaryPath) {
+    return dictionaryPath + ".wlgraph";
+}
+
+/**
+ * @brief Writes a cache file
+ * @param cachePath The cache file to write
+ * @param sourcePath The dictionary the graph was built from
+ * @param wordLength Length of every word
+ * @param words Packed words, sorted
+ * @param offsets CSR slice offsets
+ * @param neighbors CSR neighbor IDs
+ * @return true if the file was written completely
+ *
+ * The file is written under a temporary name and renamed into place, so a
+ * reader never sees a partly written cache.
+ */
+bool write(const std::string& cachePath, const std::string& sourcePath, int wordLength,
+           const std::vector<PackedWord::Key>& words,
+           const std::vector<std::uint32_t>& offsets,
+           const std::vector<std::uint32_t>& neighbors) {
+    FileHeader header{};
+    std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = formatVersion;
+    header.wordLength = static_cast<std::uint32_t>(wordLength);
+    header.wordCount = words.size();
+    header.neighborCount = neighbors.size();
+    if (!sourceStamp(sourcePath, header.sourceSize, header.sourceTime)) {
+        return false;
+    }
+
+    Checksum checksum;
+    checksum.add(words.data(), words.size() * sizeof(PackedWord::Key));
+    checksum.add(offsets.data(), offsets.size() * sizeof(std::uint32_t));
+    checksum.add(neighbors.data(), neighbors.size() * sizeof(std::uint32_t));
+    header.checksum = checksum.value();
+
+    const std::string temporaryPath = cachePath + ".tmp";
+    {
+        std::ofstream out(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(words.data()), words.size() * sizeof(PackedWord::Key));
+        out.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(std::uint32_t));
+        out.write(reinterpret_cast<const char*>(neighbors.data()), neighbors.size() * sizeof(std::uint32_t));
+        if (!out.good()) {
+            out.close();
+            std::error_code error;
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, cachePath, error);
+    if (error) {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads a cache file if it is current
+ * @param cachePath The cache file to read
+ * @param sourcePath The dictionary the cache must belong to
+ * @param contents Receives the cached data
+ * @return true if the cache exists, matches the source and passed its checksum
+ *
+ * Maps the cache file and copies the arrays out in bulk. The header is
+ * checked against the source dictionary's current size and modification
+ * time before any payload is touched.
+ */
+bool read(const std::string& cachePath, const std::string& sourcePath, Contents& contents) {
+    MappedFile file;
+    if (!file.open(cachePath) || file.size() < sizeof(FileHeader)) {
+        return false;
+    }
+
+    FileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    std::uint64_t sourceSize = 0;
+    std::int64_t sourceTime = 0;
+    if (std::memcmp(header.magic, fileMagic, sizeof(fileMagic)) != 0
+        || header.version != formatVersion
+        || header.wordLength == 0 || header.wordLength > PackedWord::maxLength
+        || !sourceStamp(sourcePath, sourceSize, sourceTime)
+        || header.sourceSize != sourceSize || header.sourceTime != sourceTime) {
+        return false;
+    }
+
+    const std::uint64_t wordBytes = header.wordCount * sizeof(PackedWord::Key);
+    const std::uint64_t offsetBytes = (header.wordCount + 1) * sizeof(std::uint32_t);
+    const std::uint64_t neighborBytes = header.neighborCount * sizeof(std::uint32_t);
+    const std::uint64_t idLimit = std::numeric_limits<std::uint32_t>::max();
+    if (header.wordCount >= idLimit || header.neighborCount >= idLimit
+        || file.size() != sizeof(FileHeader) + wordBytes + offsetBytes + neighborBytes) {
+        return false;
+    }
+
+    const char* payload = file.data() + sizeof(FileHeader);
+    Checksum checksum;
+    checksum.add(payload, static_cast<size_t>(wordBytes));
+    checksum.add(payload + wordBytes, static_cast<size_t>(offsetBytes));
+    checksum.add(payload + wordBytes + offsetBytes, static_cast<size_t>(neighborBytes));
+    if (checksum.value() != header.checksum) {
+        return false;
+    }
+
+    contents.wordLength = static_cast<int>(header.wordLength);
+    contents.words.resize(static_cast<size_t>(header.wordCount));
+    contents.offsets.resize(static_cast<size_t>(header.wordCount + 1));
+    contents.neighbors.resize(static_cast<size_t>(header.neighborCount));
+    // An empty vector may have no storage, and memcpy to null is undefined even for 0 bytes
+    if (wordBytes != 0) {
+        std::memcpy(contents.words.data(), payload, static_cast<size_t>(wordBytes));
+    }
+    if (offsetBytes != 0) {
+        std::memcpy(contents.offsets.data(), payload + wordBytes, static_cast<size_t>(offsetBytes));
+    }
+    if (neighborBytes != 0) {
+        std::memcpy(contents.neighbors.data(), payload + wordBytes + offsetBytes, static_cast<size_t>(neighborBytes));
+    }
+    return true;
+}
+
+} // namespace GraphCache
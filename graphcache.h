@@ -0,0 +1,74 @@
+#ifndef GRAPHCACHE_H
+#define GRAPHCACHE_H
+
+#include "packedword.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace GraphCache
+ * @brief Versioned binary files holding a built word graph
+ *
+ * A cache file sits next to its dictionary ("dict_4.txt" -> "dict_4.txt.wlgraph")
+ * and stores the packed word table and the CSR adjacency arrays, preceded by
+ * a header recording the format version, the size and modification time of
+ * the source dictionary, and a checksum of the payload. A cache whose source
+ * has changed, whose version differs, or whose checksum does not match is
+ * rejected so the caller can rebuild it.
+ *
+ * Arrays are written in host byte order; a cache moved to a machine of the
+ * other endianness fails the checksum and is rebuilt.
+ */
+namespace GraphCache {
+
+constexpr std::uint32_t formatVersion = 1; ///< Bumped whenever the file layout changes
+
+/**
+ * @struct Contents
+ * @brief The data stored in a cache file
+ */
+struct Contents {
+    int wordLength = 0;                    ///< Length of every word
+    std::vector<PackedWord::Key> words;    ///< Packed words, sorted; the index is the node ID
+    std::vector<std::uint32_t> offsets;    ///< CSR slice offsets, of size words + 1
+    std::vector<std::uint32_t> neighbors;  ///< CSR neighbor IDs
+};
+
+/**
+ * @brief Gets the cache file path for a dictionary
+ * @param dictionaryPath The path of the dictionary file
+ * @return The path of its cache file
+ */
+std::string cachePathFor(const std::string& dictionaryPath);
+
+/**
+ * @brief Writes a cache file
+ * @param cachePath The cache file to write
+ * @param sourcePath The dictionary the graph was built from
+ * @param wordLength Length of every word
+ * @param words Packed words, sorted
+ * @param offsets CSR slice offsets
+ * @param neighbors CSR neighbor IDs
+ * @return true if the file was written completely
+ *
+ * The file is written under a temporary name and renamed into place, so a
+ * reader never sees a partly written cache.
+ */
+bool write(const std::string& cachePath, const std::string& sourcePath, int wordLength,
+           const std::vector<PackedWord::Key>& words,
+           const std::vector<std::uint32_t>& offsets,
+           const std::vector<std::uint32_t>& neighbors);
+
+/**
+ * @brief Reads a cache file if it is current
+ * @param cachePath The cache file to read
+ * @param sourcePath The dictionary the cache must belong to
+ * @param contents Receives the cached data
+ * @return true if the cache exists, matches the source and passed its checksum
+ */
+bool read(const std::string& cachePath, const std::string& sourcePath, Contents& contents);
+
+} // namespace GraphCache
+
+#endif // GRAPHCACHE_H
@@ -0,0 +1,300 @@
+#include "graphmanager.h"
+#include <QDir>
+
+/**
+ * @brief Constructs a manager and starts its loader thread
+ * @param parent The parent object
+ */
+GraphManager::GraphManager(QObject *parent)
+    : QObject(parent)
+    , loader(new DictionaryLoader)
+    , memoryBudget(defaultMemoryBudget)
+    , preloadEnabled(true)
+    , searchStrategy(WordLadderGame::SearchStrategy::Bidirectional)
+    , nextRequestId(1)
+    , useTick(0)
+{
+    // The loader lives on the worker thread; its signals arrive queued
+    loader->moveToThread(&loaderThread);
+    connect(&loaderThread, &QThread::finished, loader, &QObject::deleteLater);
+    connect(loader, &DictionaryLoader::progress, this, &GraphManager::onLoaderProgress);
+    connect(loader, &DictionaryLoader::loaded, this, &GraphManager::onLoaderLoaded);
+    connect(loader, &DictionaryLoader::failed, this, &GraphManager::onLoaderFailed);
+    connect(loader, &DictionaryLoader::cancelled, this, &GraphManager::onLoaderCancelled);
+    loaderThread.start();
+}
+
+/**
+ * @brief Cancels outstanding loads and stops the loader thread
+ */
+GraphManager::~GraphManager() {
+    for (auto& entry : pending) {
+        entry.second.cancelFlag->store(true);
+    }
+    loaderThread.quit();
+    loaderThread.wait();
+}
+
+/**
+ * @brief Sets the directory holding the dictionary files
+ * @param directory The directory searched for "dict_[length].txt"
+ */
+void GraphManager::setDictionaryDirectory(const QString& directory) {
+    dictionaryDirectory = directory;
+}
+
+/**
+ * @brief Sets the memory budget for resident graphs
+ * @param bytes The budget in bytes
+ */
+void GraphManager::setMemoryBudget(size_t bytes) {
+    memoryBudget = bytes;
+    evictToBudget();
+}
+
+/**
+ * @brief Gets the memory budget for resident graphs
+ * @return The budget in bytes
+ */
+size_t GraphManager::getMemoryBudget() const {
+    return memoryBudget;
+}
+
+/**
+ * @brief Gets the memory held by resident graphs
+ * @return The sum of WordLadderGame::memoryUsage over resident games
+ *
+ * Uses the sizes measured when the games were loaded; the per-game tables
+ * a game grows later (distance tables, search buffers) are small next to
+ * the graph itself.
+ */
+size_t GraphManager::memoryUsage() const {
+    size_t bytes = 0;
+    for (const auto& entry : residents) {
+        bytes += entry.second.bytes;
+    }
+    return bytes;
+}
+
+/**
+ * @brief Enables or disables background preloading of neighboring lengths
+ * @param enabled Whether to preload length - 1 and length + 1 after a request completes
+ */
+void GraphManager::setPreloadNeighbors(bool enabled) {
+    preloadEnabled = enabled;
+}
+
+/**
+ * @brief Sets the search strategy of games loaded from now on
+ * @param strategy The strategy to set on new games
+ */
+void GraphManager::setSearchStrategy(WordLadderGame::SearchStrategy strategy) {
+    searchStrategy = strategy;
+}
+
+/**
+ * @brief Looks up the resident graph for a word length
+ * @param length The word length
+ * @return The game for that length, or null if it is not resident
+ */
+std::shared_ptr<WordLadderGame> GraphManager::graphFor(int length) {
+    auto it = residents.find(length);
+    if (it == residents.end()) {
+        return nullptr;
+    }
+    it->second.lastUse = ++useTick;
+    return it->second.game;
+}
+
+/**
+ * @brief Checks whether a word length is being loaded
+ * @param length The word length
+ * @return true if a load for that length is queued or running
+ */
+bool GraphManager::isLoading(int length) const {
+    return pending.count(length) != 0;
+}
+
+/**
+ * @brief Requests the graph for a word length
+ * @param length The word length
+ *
+ * The loader works through its queue in order, so any other outstanding
+ * load, requested or preload, is cancelled to put this one next in line.
+ * A preload of the same length keeps running and is marked as requested.
+ */
+void GraphManager::request(int length) {
+    std::shared_ptr<WordLadderGame> game = graphFor(length);
+    if (game) {
+        emit ready(length, game);
+        return;
+    }
+
+    for (auto& entry : pending) {
+        if (entry.first != length) {
+            entry.second.cancelFlag->store(true);
+        }
+    }
+
+    auto it = pending.find(length);
+    if (it != pending.end() && !it->second.cancelFlag->load()) {
+        it->second.requested = true;
+    } else {
+        startLoad(length, true); // Replaces a load of this length cancelled earlier
+    }
+}
+
+/**
+ * @brief Queues a load on the loader thread
+ * @param length The word length to load
+ * @param requested Whether a caller waits for it
+ */
+void GraphManager::startLoad(int length, bool requested) {
+    Pending load;
+    load.requestId = nextRequestId++;
+    load.cancelFlag = std::make_shared<std::atomic<bool>>(false);
+    load.requested = requested;
+    pending[length] = load;
+
+    const QString dictPath = QDir(dictionaryDirectory).absoluteFilePath(QString("dict_%1.txt").arg(length));
+    DictionaryLoader* target = loader;
+    const quint64 requestId = load.requestId;
+    const WordLadderGame::SearchStrategy strategy = searchStrategy;
+    const std::shared_ptr<std::atomic<bool>> cancelFlag = load.cancelFlag;
+    QMetaObject::invokeMethod(loader, [target, requestId, dictPath, length, strategy, cancelFlag]() {
+        target->load(requestId, dictPath, length, strategy, cancelFlag);
+    }, Qt::QueuedConnection);
+}
+
+/**
+ * @brief Finds the pending load of a loader request
+ * @param requestId The loader request ID
+ * @return An iterator into pending, or pending.end()
+ *
+ * A cancelled load is replaced in pending when its length is requested
+ * again, so stale request IDs find nothing.
+ */
+std::map<int, GraphManager::Pending>::iterator GraphManager::findPending(quint64 requestId) {
+    for (auto it = pending.begin(); it != pending.end(); ++it) {
+        if (it->second.requestId == requestId) {
+            return it;
+        }
+    }
+    return pending.end();
+}
+
+/**
+ * @brief Forwards progress of requested loads
+ * @param requestId The loader request
+ * @param wordsRead Words accepted from the dictionary so far
+ * @param edgesFound Edges found by the graph build so far
+ * @param percent Overall completion, 0 to 100
+ *
+ * Preloads run silently.
+ */
+void GraphManager::onLoaderProgress(quint64 requestId, qulonglong wordsRead, qulonglong edgesFound, int percent) {
+    auto it = findPending(requestId);
+    if (it != pending.end() && it->second.requested) {
+        emit progress(it->first, wordsRead, edgesFound, percent);
+    }
+}
+
+/**
+ * @brief Makes a loaded game resident
+ * @param requestId The finished loader request
+ * @param game The loaded game
+ *
+ * A requested graph becomes the most recently used one and its neighbors
+ * are preloaded; a preloaded graph enters as the least recently used one.
+ * Either way the budget is enforced afterwards.
+ */
+void GraphManager::onLoaderLoaded(quint64 requestId, std::shared_ptr<WordLadderGame> game) {
+    auto it = findPending(requestId);
+    if (it == pending.end()) {
+        return;
+    }
+    const int length = it->first;
+    const bool requested = it->second.requested;
+    pending.erase(it);
+
+    Resident& resident = residents[length];
+    resident.game = game;
+    resident.bytes = game->memoryUsage();
+    resident.lastUse = requested ? ++useTick : 0;
+    evictToBudget();
+
+    if (requested) {
+        emit ready(length, game);
+        preloadNeighbors(length);
+    }
+}
+
+/**
+ * @brief Drops a failed load
+ * @param requestId The failed loader request
+ * @param path The path of the dictionary file
+ *
+ * Failed preloads are not reported; a missing dictionary for a neighboring
+ * length is normal.
+ */
+void GraphManager::onLoaderFailed(quint64 requestId, const QString& path) {
+    auto it = findPending(requestId);
+    if (it == pending.end()) {
+        return;
+    }
+    const int length = it->first;
+    const bool requested = it->second.requested;
+    pending.erase(it);
+    if (requested) {
+        emit failed(length, path);
+    }
+}
+
+/**
+ * @brief Drops a cancelled load
+ * @param requestId The cancelled loader request
+ */
+void GraphManager::onLoaderCancelled(quint64 requestId) {
+    auto it = findPending(requestId);
+    if (it != pending.end()) {
+        pending.erase(it);
+    }
+}
+
+/**
+ * @brief Evicts least recently used graphs until usage fits the budget
+ *
+ * The most recently used graph is never evicted.
+ */
+void GraphManager::evictToBudget() {
+    while (residents.size() > 1 && memoryUsage() > memoryBudget) {
+        auto victim = residents.begin();
+        for (auto it = residents.begin(); it != residents.end(); ++it) {
+            if (it->second.lastUse < victim->second.lastUse) {
+                victim = it;
+            }
+        }
+        residents.erase(victim);
+    }
+}
+
+/**
+ * @brief Queues preloads of the lengths next to a word length
+ * @param length The word length whose neighbors to preload
+ *
+ * Skips lengths outside the managed range, lengths already resident or
+ * loading, and everything once the budget is used up.
+ */
+void GraphManager::preloadNeighbors(int length) {
+    if (!preloadEnabled) {
+        return;
+    }
+    for (int neighbor : {length - 1, length + 1}) {
+        if (neighbor < minLength || neighbor > maxLength
+            || residents.count(neighbor) != 0 || pending.count(neighbor) != 0
+            || memoryUsage() >= memoryBudget) {
+            continue;
+        }
+        startLoad(neighbor, false);
+    }
+}
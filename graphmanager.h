@@ -0,0 +1,219 @@
+#ifndef GRAPHMANAGER_H
+#define GRAPHMANAGER_H
+
+#include <QObject>
+#include <QString>
+#include <QThread>
+#include <atomic>
+#include <map>
+#include <memory>
+#include "wordladdergame.h"
+#include "dictionaryloader.h"
+
+/**
+ * @class GraphManager
+ * @brief Keeps word graphs for several word lengths resident at once
+ *
+ * Each word length has its own WordLadderGame, loaded from "dict_[length].txt"
+ * by a DictionaryLoader on a worker thread. Loaded games stay resident until
+ * the total memory they hold exceeds a budget, at which point the least
+ * recently used ones are evicted. Switching to a resident length is a map
+ * lookup.
+ *
+ * After a requested length finishes loading, the neighboring lengths can be
+ * preloaded in the background. Preloads never displace graphs that have been
+ * used: a preloaded graph counts as the least recently used one until it is
+ * looked up, so a preload that does not fit the budget is dropped again.
+ *
+ * Games are handed out as shared pointers, so a caller may keep using an
+ * evicted game (e.g. for a game in progress); its memory is released when
+ * the last handle goes away. All methods must be called on the GUI thread.
+ */
+class GraphManager : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr int minLength = 3;  ///< Shortest word length managed
+    static constexpr int maxLength = 10; ///< Longest word length managed
+    static constexpr size_t defaultMemoryBudget = size_t(512) << 20; ///< Default budget of 512 MiB
+
+    /**
+     * @brief Constructs a manager and starts its loader thread
+     * @param parent The parent object
+     */
+    explicit GraphManager(QObject *parent = nullptr);
+
+    /**
+     * @brief Cancels outstanding loads and stops the loader thread
+     */
+    ~GraphManager();
+
+    /**
+     * @brief Sets the directory holding the dictionary files
+     * @param directory The directory searched for "dict_[length].txt"
+     */
+    void setDictionaryDirectory(const QString& directory);
+
+    /**
+     * @brief Sets the memory budget for resident graphs
+     * @param bytes The budget in bytes; graphs are evicted until usage fits
+     *
+     * The most recently used graph is always kept, even if it alone
+     * exceeds the budget.
+     */
+    void setMemoryBudget(size_t bytes);
+
+    /**
+     * @brief Gets the memory budget for resident graphs
+     * @return The budget in bytes
+     */
+    size_t getMemoryBudget() const;
+
+    /**
+     * @brief Gets the memory held by resident graphs
+     * @return The sum of WordLadderGame::memoryUsage over resident games
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Enables or disables background preloading of neighboring lengths
+     * @param enabled Whether to preload length - 1 and length + 1 after a request completes
+     */
+    void setPreloadNeighbors(bool enabled);
+
+    /**
+     * @brief Sets the search strategy of games loaded from now on
+     * @param strategy The strategy; landmark tables for A* are built on the loader thread either way
+     */
+    void setSearchStrategy(WordLadderGame::SearchStrategy strategy);
+
+    /**
+     * @brief Looks up the resident graph for a word length
+     * @param length The word length
+     * @return The game for that length, or null if it is not resident
+     *
+     * Marks the graph as most recently used.
+     */
+    std::shared_ptr<WordLadderGame> graphFor(int length);
+
+    /**
+     * @brief Checks whether a word length is being loaded
+     * @param length The word length
+     * @return true if a load for that length is queued or running
+     */
+    bool isLoading(int length) const;
+
+    /**
+     * @brief Requests the graph for a word length
+     * @param length The word length
+     *
+     * Emits ready right away if the graph is resident. Otherwise starts
+     * loading it, or promotes a running preload of it, and cancels every
+     * other outstanding load so this one is not kept waiting.
+     */
+    void request(int length);
+
+signals:
+    /**
+     * @brief Reports the progress of a requested load
+     * @param length The word length being loaded
+     * @param wordsRead Words accepted from the dictionary so far
+     * @param edgesFound Edges found by the graph build so far
+     * @param percent Overall completion, 0 to 100
+     */
+    void progress(int length, qulonglong wordsRead, qulonglong edgesFound, int percent);
+
+    /**
+     * @brief Reports that a requested graph is resident
+     * @param length The word length
+     * @param game The game for that length
+     */
+    void ready(int length, std::shared_ptr<WordLadderGame> game);
+
+    /**
+     * @brief Reports that a requested dictionary could not be loaded
+     * @param length The word length
+     * @param path The path of the dictionary file
+     */
+    void failed(int length, const QString& path);
+
+private slots:
+    /**
+     * @brief Forwards progress of requested loads
+     */
+    void onLoaderProgress(quint64 requestId, qulonglong wordsRead, qulonglong edgesFound, int percent);
+
+    /**
+     * @brief Makes a loaded game resident
+     */
+    void onLoaderLoaded(quint64 requestId, std::shared_ptr<WordLadderGame> game);
+
+    /**
+     * @brief Drops a failed load
+     */
+    void onLoaderFailed(quint64 requestId, const QString& path);
+
+    /**
+     * @brief Drops a cancelled load
+     */
+    void onLoaderCancelled(quint64 requestId);
+
+private:
+    /**
+     * @struct Resident
+     * @brief A loaded graph and its position in the LRU order
+     */
+    struct Resident {
+        std::shared_ptr<WordLadderGame> game; ///< The loaded game
+        size_t bytes = 0;                     ///< memoryUsage of the game when it was loaded
+        quint64 lastUse = 0;                  ///< Use tick; smaller is less recently used
+    };
+
+    /**
+     * @struct Pending
+     * @brief A load queued on the loader thread
+     */
+    struct Pending {
+        quint64 requestId = 0;                         ///< Loader request ID
+        std::shared_ptr<std::atomic<bool>> cancelFlag; ///< Raised to abort the load
+        bool requested = false;                        ///< Whether a caller waits for it, as opposed to a preload
+    };
+
+    /**
+     * @brief Queues a load on the loader thread
+     * @param length The word length to load
+     * @param requested Whether a caller waits for it
+     */
+    void startLoad(int length, bool requested);
+
+    /**
+     * @brief Finds the pending load of a loader request
+     * @param requestId The loader request ID
+     * @return An iterator into pending, or pending.end()
+     */
+    std::map<int, Pending>::iterator findPending(quint64 requestId);
+
+    /**
+     * @brief Evicts least recently used graphs until usage fits the budget
+     */
+    void evictToBudget();
+
+    /**
+     * @brief Queues preloads of the lengths next to a word length
+     * @param length The word length whose neighbors to preload
+     */
+    void preloadNeighbors(int length);
+
+    QThread loaderThread;              ///< Worker thread running the loader
+    DictionaryLoader* loader;          ///< Deleted when loaderThread finishes
+    QString dictionaryDirectory;       ///< Directory holding the dictionary files
+    size_t memoryBudget;               ///< Budget for resident graphs in bytes
+    bool preloadEnabled;               ///< Whether neighbors are preloaded
+    WordLadderGame::SearchStrategy searchStrategy; ///< Strategy of newly loaded games
+    std::map<int, Resident> residents; ///< Resident graphs by word length
+    std::map<int, Pending> pending;    ///< Outstanding loads by word length
+    quint64 nextRequestId;             ///< ID of the next loader request
+    quint64 useTick;                   ///< Counter for the LRU order
+};
+
+#endif // GRAPHMANAGER_H
@@ -0,0 +1,264 @@
+#include "graphstats.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <system_error>
+
+namespace {
+
+const char distancesMagic[8] = {'W', 'L', 'D', 'I', 'S', 'T', '\0', '\0'};
+constexpr std::uint32_t distancesVersion = 1;
+
+/**
+ * @struct DistancesHeader
+ * @brief Fixed-size header of a distance matrix file
+ *
+ * Followed by the words, wordLength letters each with no separators, then
+ * wordCount * wordCount distance bytes in row-major order.
+ */
+struct DistancesHeader {
+    char magic[8];             ///< distancesMagic
+    std::uint32_t version;     ///< distancesVersion at write time
+    std::uint32_t wordLength;  ///< Length of every word
+    std::uint64_t wordCount;   ///< Number of words, rows and columns
+};
+
+} // namespace
+
+/**
+ * @brief Assembles the statistics computed by the game
+ * @param words The words, in node order
+ * @param eccentricities The eccentricity of each word, 0 for isolated words
+ * @param histogram Ordered pairs of different words at each ladder length; entry 0 is 0
+ * @param distances The row-major distance matrix, or empty if it was not requested
+ * @param diameterStart Index of a word at one end of a longest ladder
+ * @param diameterEnd Index of the word at the other end
+ */
+GraphStatistics::GraphStatistics(std::vector<std::string> words, std::vector<std::uint32_t> eccentricities,
+                                 std::vector<std::uint64_t> histogram, std::vector<std::uint8_t> distances,
+                                 size_t diameterStart, size_t diameterEnd)
+    : words(std::move(words))
+    , eccentricities(std::move(eccentricities))
+    , histogram(std::move(histogram))
+    , distances(std::move(distances))
+    , diameterStart(diameterStart)
+    , diameterEnd(diameterEnd) {
+    // Trailing empty lengths would overstate the diameter
+    while (!this->histogram.empty() && this->histogram.back() == 0) {
+        this->histogram.pop_back();
+    }
+}
+
+/**
+ * @brief Gets the number of words
+ * @return The number of words measured
+ */
+size_t GraphStatistics::wordCount() const {
+    return words.size();
+}
+
+/**
+ * @brief Gets a word
+ * @param index The word's index, below wordCount()
+ * @return The word
+ */
+const std::string& GraphStatistics::word(size_t index) const {
+    return words[index];
+}
+
+/**
+ * @brief Gets the eccentricity of a word
+ * @param index The word's index, below wordCount()
+ * @return The longest shortest ladder from the word, 0 if it has no neighbor
+ */
+std::uint32_t GraphStatistics::eccentricity(size_t index) const {
+    return eccentricities[index];
+}
+
+/**
+ * @brief Gets the longest shortest ladder
+ * @return The diameter in moves, 0 if no two words are connected
+ */
+int GraphStatistics::diameter() const {
+    return histogram.empty() ? 0 : static_cast<int>(histogram.size()) - 1;
+}
+
+/**
+ * @brief Gets the smallest eccentricity among words with a neighbor
+ * @return The radius in moves, 0 if no two words are connected
+ */
+int GraphStatistics::radius() const {
+    std::uint32_t smallest = 0;
+    for (std::uint32_t value : eccentricities) {
+        if (value != 0 && (smallest == 0 || value < smallest)) {
+            smallest = value;
+        }
+    }
+    return static_cast<int>(smallest);
+}
+
+/**
+ * @brief Gets the words at the ends of a longest ladder
+ * @param startWord Receives the first word
+ * @param targetWord Receives the second word
+ * @return false if no two words are connected
+ */
+bool GraphStatistics::diametralPair(std::string& startWord, std::string& targetWord) const {
+    if (diameter() == 0) {
+        return false;
+    }
+    startWord = words[diameterStart];
+    targetWord = words[diameterEnd];
+    return true;
+}
+
+/**
+ * @brief Gets the number of ordered pairs of different connected words
+ * @return The sum of the distance histogram
+ */
+std::uint64_t GraphStatistics::connectedPairs() const {
+    std::uint64_t total = 0;
+    for (std::uint64_t count : histogram) {
+        total += count;
+    }
+    return total;
+}
+
+/**
+ * @brief Gets the mean ladder length over every connected pair
+ * @return The average number of moves, 0 if no two words are connected
+ */
+double GraphStatistics::averageDistance() const {
+    double moves = 0.0;
+    for (size_t distance = 1; distance < histogram.size(); ++distance) {
+        moves += static_cast<double>(distance) * static_cast<double>(histogram[distance]);
+    }
+    const std::uint64_t pairs = connectedPairs();
+    return pairs == 0 ? 0.0 : moves / static_cast<double>(pairs);
+}
+
+/**
+ * @brief Gets the number of ordered pairs at each ladder length
+ * @return Entry d counts the pairs whose shortest ladder has d moves
+ */
+const std::vector<std::uint64_t>& GraphStatistics::distanceHistogram() const {
+    return histogram;
+}
+
+/**
+ * @brief Gets the number of words of each eccentricity
+ * @return Entry e counts the words whose eccentricity is e
+ */
+std::vector<std::uint64_t> GraphStatistics::eccentricityHistogram() const {
+    std::vector<std::uint64_t> counts;
+    for (std::uint32_t value : eccentricities) {
+        if (value >= counts.size()) {
+            counts.resize(value + 1, 0);
+        }
+        ++counts[value];
+    }
+    return counts;
+}
+
+/**
+ * @brief Checks whether the distance matrix was kept
+ * @return true if distance() may be called
+ */
+bool GraphStatistics::hasDistances() const {
+    return !words.empty() && distances.size() == words.size() * words.size();
+}
+
+/**
+ * @brief Gets the length of the shortest ladder between two words
+ * @param from Index of the first word
+ * @param to Index of the second word
+ * @return The number of moves, clamped to maxDistance, or unreachable
+ */
+std::uint8_t GraphStatistics::distance(size_t from, size_t to) const {
+    return distances[from * words.size() + to];
+}
+
+/**
+ * @brief Writes a human-readable summary
+ * @param out The stream to write to
+ *
+ * Lists the word count, diameter with one of its pairs, radius, average
+ * ladder length and both histograms, one length per line.
+ */
+void GraphStatistics::writeReport(std::ostream& out) const {
+    const std::vector<std::uint64_t> eccentricityCounts = eccentricityHistogram();
+    const std::uint64_t isolated = eccentricityCounts.empty() ? 0 : eccentricityCounts[0];
+    out << "Words: " << words.size();
+    if (!words.empty()) {
+        out << " of length " << words.front().size();
+    }
+    out << "\nIsolated words: " << isolated
+        << "\nConnected pairs: " << connectedPairs()
+        << "\nDiameter: " << diameter();
+    std::string start;
+    std::string target;
+    if (diametralPair(start, target)) {
+        out << " (" << start << " -> " << target << ")";
+    }
+    out << "\nRadius: " << radius()
+        << "\nAverage ladder: " << std::fixed << std::setprecision(3) << averageDistance() << " moves\n";
+
+    out << "Ladder lengths (moves, ordered pairs):\n";
+    for (size_t distance = 1; distance < histogram.size(); ++distance) {
+        out << std::setw(6) << distance << std::setw(16) << histogram[distance] << "\n";
+    }
+    out << "Eccentricities (moves, words):\n";
+    for (size_t value = 1; value < eccentricityCounts.size(); ++value) {
+        if (eccentricityCounts[value] != 0) {
+            out << std::setw(6) << value << std::setw(16) << eccentricityCounts[value] << "\n";
+        }
+    }
+}
+
+/**
+ * @brief Saves the words and the distance matrix to a binary file
+ * @param path The file to write
+ * @return true if the matrix was kept and the file written completely
+ *
+ * The file is written in host byte order, like the graph cache, to a
+ * temporary name first and renamed into place once complete.
+ */
+bool GraphStatistics::writeDistances(const std::string& path) const {
+    if (!hasDistances()) {
+        return false;
+    }
+    DistancesHeader header{};
+    std::memcpy(header.magic, distancesMagic, sizeof(distancesMagic));
+    header.version = distancesVersion;
+    header.wordLength = static_cast<std::uint32_t>(words.front().size());
+    header.wordCount = words.size();
+
+    const std::string temporaryPath = path + ".tmp";
+    {
+        std::ofstream out(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const std::string& word : words) {
+            out.write(word.data(), static_cast<std::streamsize>(word.size()));
+        }
+        out.write(reinterpret_cast<const char*>(distances.data()), static_cast<std::streamsize>(distances.size()));
+        if (!out.good()) {
+            out.close();
+            std::error_code error;
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error) {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    return true;
+}
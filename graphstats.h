@@ -0,0 +1,145 @@
+#ifndef GRAPHSTATS_H
+#define GRAPHSTATS_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @class GraphStatistics
+ * @brief Shortest ladder lengths between every pair of words of a dictionary
+ *
+ * Holds the eccentricity of every word (the longest shortest ladder from it
+ * to a word it is connected to), the number of ordered word pairs at each
+ * ladder length and one pair at the diameter. Optionally it also keeps the
+ * full distance matrix, one byte per ordered pair, which is only practical
+ * for small dictionaries.
+ *
+ * Words are indexed in node order, which is alphabetical order until the
+ * dictionary is edited. Removed words are not included.
+ */
+class GraphStatistics {
+public:
+    static constexpr std::uint8_t unreachable = 255;  ///< Matrix entry of words with no ladder between them
+    static constexpr std::uint8_t maxDistance = 254;  ///< Largest ladder length the matrix can hold; longer ones are clamped
+
+    /**
+     * @brief Constructs empty statistics, as for an empty dictionary
+     */
+    GraphStatistics() = default;
+
+    /**
+     * @brief Assembles the statistics computed by the game
+     * @param words The words, in node order
+     * @param eccentricities The eccentricity of each word, 0 for isolated words
+     * @param histogram Ordered pairs of different words at each ladder length; entry 0 is 0
+     * @param distances The row-major distance matrix, or empty if it was not requested
+     * @param diameterStart Index of a word at one end of a longest ladder
+     * @param diameterEnd Index of the word at the other end
+     */
+    GraphStatistics(std::vector<std::string> words, std::vector<std::uint32_t> eccentricities,
+                    std::vector<std::uint64_t> histogram, std::vector<std::uint8_t> distances,
+                    size_t diameterStart, size_t diameterEnd);
+
+    /**
+     * @brief Gets the number of words
+     * @return The number of words measured
+     */
+    size_t wordCount() const;
+
+    /**
+     * @brief Gets a word
+     * @param index The word's index, below wordCount()
+     * @return The word
+     */
+    const std::string& word(size_t index) const;
+
+    /**
+     * @brief Gets the eccentricity of a word
+     * @param index The word's index, below wordCount()
+     * @return The longest shortest ladder from the word, 0 if it has no neighbor
+     */
+    std::uint32_t eccentricity(size_t index) const;
+
+    /**
+     * @brief Gets the longest shortest ladder
+     * @return The diameter in moves, 0 if no two words are connected
+     */
+    int diameter() const;
+
+    /**
+     * @brief Gets the smallest eccentricity among words with a neighbor
+     * @return The radius in moves, 0 if no two words are connected
+     */
+    int radius() const;
+
+    /**
+     * @brief Gets the words at the ends of a longest ladder
+     * @param startWord Receives the first word
+     * @param targetWord Receives the second word
+     * @return false if no two words are connected
+     */
+    bool diametralPair(std::string& startWord, std::string& targetWord) const;
+
+    /**
+     * @brief Gets the number of ordered pairs of different connected words
+     * @return The sum of the distance histogram
+     */
+    std::uint64_t connectedPairs() const;
+
+    /**
+     * @brief Gets the mean ladder length over every connected pair
+     * @return The average number of moves, 0 if no two words are connected
+     */
+    double averageDistance() const;
+
+    /**
+     * @brief Gets the number of ordered pairs at each ladder length
+     * @return Entry d counts the pairs whose shortest ladder has d moves
+     */
+    const std::vector<std::uint64_t>& distanceHistogram() const;
+
+    /**
+     * @brief Gets the number of words of each eccentricity
+     * @return Entry e counts the words whose eccentricity is e
+     */
+    std::vector<std::uint64_t> eccentricityHistogram() const;
+
+    /**
+     * @brief Checks whether the distance matrix was kept
+     * @return true if distance() may be called
+     */
+    bool hasDistances() const;
+
+    /**
+     * @brief Gets the length of the shortest ladder between two words
+     * @param from Index of the first word
+     * @param to Index of the second word
+     * @return The number of moves, clamped to maxDistance, or unreachable
+     */
+    std::uint8_t distance(size_t from, size_t to) const;
+
+    /**
+     * @brief Writes a human-readable summary
+     * @param out The stream to write to
+     */
+    void writeReport(std::ostream& out) const;
+
+    /**
+     * @brief Saves the words and the distance matrix to a binary file
+     * @param path The file to write
+     * @return true if the matrix was kept and the file written completely
+     */
+    bool writeDistances(const std::string& path) const;
+
+private:
+    std::vector<std::string> words;             ///< Word of each index, in node order
+    std::vector<std::uint32_t> eccentricities;  ///< Eccentricity of each word
+    std::vector<std::uint64_t> histogram;       ///< Ordered pairs at each ladder length
+    std::vector<std::uint8_t> distances;        ///< Row-major distance matrix, empty unless requested
+    size_t diameterStart = 0;                   ///< Index of one end of a longest ladder
+    size_t diameterEnd = 0;                     ///< Index of its other end
+};
+
+#endif // GRAPHSTATS_H
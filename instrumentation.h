@@ -0,0 +1,87 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <cstddef>
+
+/**
+ * @file instrumentation.h
+ * @brief Compile-time switch and counters for load, build and search instrumentation
+ *
+ * Wall times are always measured. The remaining counters are only
+ * maintained when WORDLADDER_INSTRUMENTATION is non-zero (the default);
+ * building with WORDLADDER_INSTRUMENTATION=0 removes every counter update,
+ * so the hot loops compile to the same code as without instrumentation and
+ * the counters read zero.
+ *
+ * The allocation counters are estimates; the allocator itself is not
+ * hooked. Buffers that grow while a step runs are counted by comparing
+ * their capacity before and after, once per growth check, and the arrays a
+ * step always builds afresh count one each. Temporaries inside the standard
+ * library, such as sort buffers and copies, are not seen.
+ */
+
+#ifndef WORDLADDER_INSTRUMENTATION
+#define WORDLADDER_INSTRUMENTATION 1
+#endif
+
+#if WORDLADDER_INSTRUMENTATION
+#define WL_INSTRUMENT(...) __VA_ARGS__
+#else
+#define WL_INSTRUMENT(...) ((void)0)
+#endif
+
+/**
+ * @struct LoadCounters
+ * @brief Counters of the last dictionary load
+ */
+struct LoadCounters {
+    double wallMs = 0.0;        ///< Wall-clock duration of the load
+    bool fromCache = false;     ///< Whether a graph cache file was read instead of the dictionary
+    size_t bytesRead = 0;       ///< Bytes of the file read (dictionary or cache)
+    size_t linesRead = 0;       ///< Non-blank lines scanned
+    size_t wordsKept = 0;       ///< Distinct words in the dictionary
+    size_t wordsRejected = 0;   ///< Lines of the wrong length or with characters other than letters
+    size_t duplicates = 0;      ///< Repeated words removed
+    size_t estimatedAllocations = 0; ///< Heap allocations of the word tables, estimated
+};
+
+/**
+ * @struct BuildCounters
+ * @brief Counters of the last graph build
+ */
+struct BuildCounters {
+    double wallMs = 0.0;        ///< Wall-clock duration of the build
+    unsigned threads = 0;       ///< Threads that found edges
+    size_t workItems = 0;       ///< (position, letter) work items processed
+    size_t edgesCreated = 0;    ///< Edges in the graph
+    size_t estimatedAllocations = 0; ///< Heap allocations of edge buffers and graph arrays, estimated
+};
+
+/**
+ * @struct SearchStats
+ * @brief Statistics of a single shortest-path query
+ *
+ * nodesExpanded and elapsedMicros are always filled in; the other counters
+ * only when instrumentation is compiled in.
+ */
+struct SearchStats {
+    size_t nodesExpanded = 0;   ///< Nodes taken off a queue or frontier
+    double elapsedMicros = 0.0; ///< Wall-clock duration of the search
+    size_t edgesScanned = 0;    ///< Neighbor entries examined
+    size_t peakFrontier = 0;    ///< Largest queue, frontier or open list seen
+    size_t estimatedAllocations = 0; ///< Heap allocations of scratch buffers and the result, estimated
+};
+
+/**
+ * @struct Instrumentation
+ * @brief Counters of the last load, build and search of a game
+ */
+struct Instrumentation {
+    static constexpr bool enabled = WORDLADDER_INSTRUMENTATION != 0; ///< Whether counters are compiled in
+
+    LoadCounters load;   ///< Last loadDictionary or cached load
+    BuildCounters build; ///< Last buildGraph
+    SearchStats search;  ///< Last findShortestPath through the game's own context
+};
+
+#endif // INSTRUMENTATION_H
@@ -0,0 +1,236 @@
+#include "ladderdag.h"
+#include <algorithm>
+#include <limits>
+
+/**
+ * @brief Builds a DAG from its layers and links
+ * @param words The word of each node, layer by layer; node 0 is the start, the last node the target
+ * @param layerOffsets Start of each layer in words, of size layers + 1
+ * @param successorOffsets Start of each node's successors, of size words + 1
+ * @param successors The successors of all nodes, each in the next layer
+ *
+ * Successors always lie in a later layer, so walking the nodes in reverse
+ * order visits every successor before its predecessors. The count of a
+ * node is the sum over its successors, clamped at UINT64_MAX; a parallel
+ * floating-point count keeps the ratios needed for sampling once the
+ * integers saturate.
+ */
+LadderDag::LadderDag(std::vector<std::string> words, std::vector<std::uint32_t> layerOffsets,
+                     std::vector<std::uint32_t> successorOffsets, std::vector<std::uint32_t> successors)
+    : words(std::move(words))
+    , layerOffsets(std::move(layerOffsets))
+    , successorOffsets(std::move(successorOffsets))
+    , successors(std::move(successors)) {
+    const size_t count = this->words.size();
+    pathCounts.assign(count, 0);
+    pathWeights.assign(count, 0.0);
+    if (count == 0) {
+        return;
+    }
+    pathCounts[count - 1] = 1;
+    pathWeights[count - 1] = 1.0;
+    for (size_t node = count - 1; node-- > 0; ) {
+        std::uint64_t total = 0;
+        double weight = 0.0;
+        for (std::uint32_t i = this->successorOffsets[node]; i < this->successorOffsets[node + 1]; ++i) {
+            const std::uint32_t next = this->successors[i];
+            if (total > std::numeric_limits<std::uint64_t>::max() - pathCounts[next]) {
+                total = std::numeric_limits<std::uint64_t>::max();
+                saturated = true;
+            } else {
+                total += pathCounts[next];
+            }
+            weight += pathWeights[next];
+        }
+        pathCounts[node] = total;
+        pathWeights[node] = weight;
+    }
+}
+
+/**
+ * @brief Checks whether the DAG holds no ladder
+ * @return true if the words are not connected or not in the dictionary
+ */
+bool LadderDag::empty() const {
+    return words.empty();
+}
+
+/**
+ * @brief Gets the number of moves of every ladder
+ * @return The ladder length, or -1 if the DAG is empty
+ */
+int LadderDag::length() const {
+    return layerOffsets.size() < 2 ? -1 : static_cast<int>(layerOffsets.size()) - 2;
+}
+
+/**
+ * @brief Gets the words of one layer
+ * @param layer The number of moves from the start, at most length()
+ * @return The words of that layer that lie on a minimal ladder
+ */
+std::vector<std::string> LadderDag::layer(size_t layer) const {
+    if (layer + 1 >= layerOffsets.size()) {
+        return {};
+    }
+    return std::vector<std::string>(words.begin() + layerOffsets[layer], words.begin() + layerOffsets[layer + 1]);
+}
+
+/**
+ * @brief Gets the number of minimal ladders
+ * @return The ladder count, or UINT64_MAX if it does not fit; see isCountSaturated()
+ */
+std::uint64_t LadderDag::pathCount() const {
+    return pathCounts.empty() ? 0 : pathCounts.front();
+}
+
+/**
+ * @brief Checks whether the ladder count overflowed
+ * @return true if pathCount() is a lower bound rather than the exact count
+ */
+bool LadderDag::isCountSaturated() const {
+    return saturated;
+}
+
+/**
+ * @brief Checks whether a sequence of words is one of the minimal ladders
+ * @param ladder The words, start first
+ * @return true if the ladder is a path through the DAG from start to target
+ *
+ * Follows the ladder through the successor lists, so the cost is bounded by
+ * the sum of the out-degrees along it.
+ */
+bool LadderDag::contains(const std::vector<std::string>& ladder) const {
+    if (empty() || ladder.size() != static_cast<size_t>(length()) + 1 || ladder.front() != words.front()) {
+        return false;
+    }
+    std::uint32_t node = 0;
+    for (size_t step = 1; step < ladder.size(); ++step) {
+        const auto first = successors.begin() + successorOffsets[node];
+        const auto last = successors.begin() + successorOffsets[node + 1];
+        const auto next = std::find_if(first, last, [&](std::uint32_t id) { return words[id] == ladder[step]; });
+        if (next == last) {
+            return false;
+        }
+        node = *next;
+    }
+    return true;
+}
+
+/**
+ * @brief Draws a minimal ladder uniformly at random
+ * @param engine The random number generator to use
+ * @return The words of the ladder, or an empty vector if the DAG is empty
+ *
+ * Walks from the start, taking each successor with probability proportional
+ * to the ladders through it. The product of these probabilities is the
+ * same for every ladder. Exact integer counts are used while they fit, the
+ * floating-point ones after that.
+ */
+std::vector<std::string> LadderDag::sample(std::mt19937& engine) const {
+    std::vector<std::string> ladder;
+    if (empty()) {
+        return ladder;
+    }
+    ladder.reserve(static_cast<size_t>(length()) + 1);
+    std::uint32_t node = 0;
+    ladder.push_back(words[node]);
+    while (successorOffsets[node] != successorOffsets[node + 1]) {
+        const std::uint32_t first = successorOffsets[node];
+        const std::uint32_t last = successorOffsets[node + 1];
+        std::uint32_t chosen = successors[last - 1];
+        if (!saturated) {
+            std::uniform_int_distribution<std::uint64_t> pick(0, pathCounts[node] - 1);
+            std::uint64_t remaining = pick(engine);
+            for (std::uint32_t i = first; i < last; ++i) {
+                if (remaining < pathCounts[successors[i]]) {
+                    chosen = successors[i];
+                    break;
+                }
+                remaining -= pathCounts[successors[i]];
+            }
+        } else {
+            std::uniform_real_distribution<double> pick(0.0, pathWeights[node]);
+            double remaining = pick(engine);
+            for (std::uint32_t i = first; i < last; ++i) {
+                if (remaining < pathWeights[successors[i]]) {
+                    chosen = successors[i];
+                    break;
+                }
+                remaining -= pathWeights[successors[i]];
+            }
+        }
+        node = chosen;
+        ladder.push_back(words[node]);
+    }
+    return ladder;
+}
+
+/**
+ * @brief Gets the number of words in the DAG
+ * @return The total size of all layers
+ */
+size_t LadderDag::nodeCount() const {
+    return words.size();
+}
+
+/**
+ * @brief Starts an enumeration
+ * @param dag The DAG whose ladders to list
+ */
+LadderDag::Enumerator::Enumerator(const LadderDag& dag)
+    : dag(&dag)
+    , started(false) {
+}
+
+/**
+ * @brief Produces the next ladder
+ * @param ladder Receives the words of the ladder, start first
+ * @return true if a ladder was produced, false once all have been listed
+ *
+ * Works like an odometer over the successor choices: the deepest layer
+ * with an untried successor advances, and every layer after it restarts
+ * at its first successor. Every node of the DAG reaches the target, so
+ * the first successors always complete a ladder.
+ */
+bool LadderDag::Enumerator::next(std::vector<std::string>& ladder) {
+    if (dag->empty()) {
+        return false;
+    }
+    const size_t moves = static_cast<size_t>(dag->length());
+    size_t from = 0; // First layer whose choice is reset below
+    if (!started) {
+        started = true;
+        nodes.assign(moves + 1, 0);
+        choices.assign(moves, 0);
+    } else {
+        size_t layer = moves;
+        while (layer > 0) {
+            --layer;
+            const std::uint32_t node = nodes[layer];
+            if (dag->successorOffsets[node] + choices[layer] + 1 < dag->successorOffsets[node + 1]) {
+                ++choices[layer];
+                break;
+            }
+            if (layer == 0) {
+                return false; // Every combination has been listed
+            }
+        }
+        if (moves == 0) {
+            return false; // The only ladder is the start word alone
+        }
+        from = layer;
+        for (size_t later = layer + 1; later < moves; ++later) {
+            choices[later] = 0;
+        }
+    }
+    for (size_t layer = from; layer < moves; ++layer) {
+        nodes[layer + 1] = dag->successors[dag->successorOffsets[nodes[layer]] + choices[layer]];
+    }
+
+    ladder.clear();
+    ladder.reserve(moves + 1);
+    for (std::uint32_t node : nodes) {
+        ladder.push_back(dag->words[node]);
+    }
+    return true;
+}
@@ -0,0 +1,134 @@
+#ifndef LADDERDAG_H
+#define LADDERDAG_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <random>
+
+/**
+ * @class LadderDag
+ * @brief Every shortest ladder between two words, as a layered DAG
+ *
+ * Layer i holds the words i moves from the start that lie on some shortest
+ * ladder to the target; layer 0 is the start word and the last layer the
+ * target. Each word links to its one-letter neighbors in the next layer, so
+ * every path through the DAG is a minimal ladder and every minimal ladder is
+ * such a path. The DAG is as large as the union of the ladders, not their
+ * number, which grows exponentially with the length on dense graphs.
+ *
+ * Nodes are numbered layer by layer and stored in CSR form. Each node also
+ * carries the number of ladders from it to the target, which gives the
+ * total count and lets sample() draw a ladder uniformly in one walk.
+ */
+class LadderDag {
+public:
+    /**
+     * @class Enumerator
+     * @brief Lazily lists the ladders of a DAG, one at a time
+     *
+     * Ladders come out in the order of the successor lists, each step
+     * costing time proportional to the ladder length. The DAG must outlive
+     * the enumerator.
+     */
+    class Enumerator {
+    public:
+        /**
+         * @brief Starts an enumeration
+         * @param dag The DAG whose ladders to list
+         */
+        explicit Enumerator(const LadderDag& dag);
+
+        /**
+         * @brief Produces the next ladder
+         * @param ladder Receives the words of the ladder, start first
+         * @return true if a ladder was produced, false once all have been listed
+         */
+        bool next(std::vector<std::string>& ladder);
+
+    private:
+        const LadderDag* dag;               ///< The DAG being enumerated
+        std::vector<std::uint32_t> nodes;   ///< Node at each layer of the current ladder
+        std::vector<std::uint32_t> choices; ///< Successor index taken at each layer but the last
+        bool started;                       ///< Whether the first ladder has been produced
+    };
+
+    /**
+     * @brief Constructs an empty DAG, meaning there is no ladder
+     */
+    LadderDag() = default;
+
+    /**
+     * @brief Builds a DAG from its layers and links
+     * @param words The word of each node, layer by layer; node 0 is the start, the last node the target
+     * @param layerOffsets Start of each layer in words, of size layers + 1
+     * @param successorOffsets Start of each node's successors, of size words + 1
+     * @param successors The successors of all nodes, each in the next layer
+     *
+     * Counts the ladders through every node, from the target back.
+     */
+    LadderDag(std::vector<std::string> words, std::vector<std::uint32_t> layerOffsets,
+              std::vector<std::uint32_t> successorOffsets, std::vector<std::uint32_t> successors);
+
+    /**
+     * @brief Checks whether the DAG holds no ladder
+     * @return true if the words are not connected or not in the dictionary
+     */
+    bool empty() const;
+
+    /**
+     * @brief Gets the number of moves of every ladder
+     * @return The ladder length, or -1 if the DAG is empty
+     */
+    int length() const;
+
+    /**
+     * @brief Gets the words of one layer
+     * @param layer The number of moves from the start, at most length()
+     * @return The words of that layer that lie on a minimal ladder
+     */
+    std::vector<std::string> layer(size_t layer) const;
+
+    /**
+     * @brief Gets the number of minimal ladders
+     * @return The ladder count, or UINT64_MAX if it does not fit; see isCountSaturated()
+     */
+    std::uint64_t pathCount() const;
+
+    /**
+     * @brief Checks whether the ladder count overflowed
+     * @return true if pathCount() is a lower bound rather than the exact count
+     */
+    bool isCountSaturated() const;
+
+    /**
+     * @brief Checks whether a sequence of words is one of the minimal ladders
+     * @param ladder The words, start first
+     * @return true if the ladder is a path through the DAG from start to target
+     */
+    bool contains(const std::vector<std::string>& ladder) const;
+
+    /**
+     * @brief Draws a minimal ladder uniformly at random
+     * @param engine The random number generator to use
+     * @return The words of the ladder, or an empty vector if the DAG is empty
+     */
+    std::vector<std::string> sample(std::mt19937& engine) const;
+
+    /**
+     * @brief Gets the number of words in the DAG
+     * @return The total size of all layers
+     */
+    size_t nodeCount() const;
+
+private:
+    std::vector<std::string> words;               ///< Word of each node, layer by layer
+    std::vector<std::uint32_t> layerOffsets;      ///< Start of each layer in words (size layers + 1)
+    std::vector<std::uint32_t> successorOffsets;  ///< Start of each node's slice in successors (size nodes + 1)
+    std::vector<std::uint32_t> successors;        ///< Successor node IDs, each in the next layer
+    std::vector<std::uint64_t> pathCounts;        ///< Ladders from each node to the target, saturating
+    std::vector<double> pathWeights;              ///< The same counts in floating point, for sampling once saturated
+    bool saturated = false;                       ///< Whether some count exceeded 64 bits
+};
+
+#endif // LADDERDAG_H
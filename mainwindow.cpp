@@ -4,7 +4,6 @@
 #include <QTextStream>
 #include <QMessageBox>
 #include <QFileDialog> // Optional: for choosing dictionary file/dir
-#include <set>         // For analytics unique words
 #include <QStandardPaths> // To find a writable location
 #include <QRegularExpression>
 #include <QDir>
@@ -29,18 +28,25 @@ std::string q2s(const QString& qs) { return qs.toStdString(); }
  * @brief Constructs the main window
  * @param parent The parent widget
  * 
- * Initializes the UI and sets up initial states for all game modes.
+ * Initializes the UI and sets up initial states for all game modes, and
+ * points the graph manager at the dictionaries in the application directory.
  */
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , ui(new Ui::MainWindow)
-    , dictionaryLoaded(false)
+    , loadInProgress(false)
+    , startGameAfterLoad(false)
     , hintsUsed_play(0)
     , optimalMovesForCurrentGame_play(0)
 {
     ui->setupUi(this);
     this->setWindowTitle("Word Ladder Game");
 
+    graphs.setDictionaryDirectory(QCoreApplication::applicationDirPath());
+    connect(&graphs, &GraphManager::progress, this, &MainWindow::onGraphProgress);
+    connect(&graphs, &GraphManager::ready, this, &MainWindow::onGraphReady);
+    connect(&graphs, &GraphManager::failed, this, &MainWindow::onGraphFailed);
+
     // Initial UI states
     ui->findPathButton_auto->setEnabled(false);
     resetPlayModeUI(false); // Initially, no game is active in play mode
@@ -53,68 +59,149 @@ MainWindow::MainWindow(QWidget *parent)
 /**
  * @brief Destructor
  * 
- * Cleans up the UI resources.
+ * Cleans up the UI resources. The graph manager cancels its own loads.
  */
 MainWindow::~MainWindow() {
     delete ui;
 }
 
 /**
- * @brief Loads and builds the dictionary for the specified word length
+ * @brief Requests the graph for the specified word length
  * @param length The word length to load
  * @param statusLabelContext The context prefix for status messages
- * @return true if dictionary was loaded successfully, false otherwise
  * 
- * Attempts to load a dictionary file named "dict_[length].txt" from the application directory.
- * If successful, builds the word graph for path finding.
+ * Asks the graph manager for the graph of "dict_[length].txt" in the
+ * application directory. A resident graph is handed back at once; otherwise
+ * it is loaded on the worker thread (or taken from the binary graph cache
+ * next to the dictionary), and the load of any other length still running
+ * is cancelled. The controls that need a graph stay disabled until the
+ * graph has been swapped in.
+ */
+void MainWindow::loadAndBuildDictionary(int length, const QString& statusLabelContext) {
+    loadStatusContext = statusLabelContext;
+    setLoadingState(true);
+    ui->statusLabel_auto->setText(statusLabelContext + QString("Loading dictionary dict_%1.txt...").arg(length));
+    graphs.setSearchStrategy(selectedSearchStrategy());
+    graphs.request(length); // May call onGraphReady before returning
+}
+
+/**
+ * @brief Shows the progress of the requested graph
+ * @param length The word length being loaded
+ * @param wordsRead Words accepted from the dictionary so far
+ * @param edgesFound Edges found by the graph build so far
+ * @param percent Overall completion, 0 to 100
  */
-bool MainWindow::loadAndBuildDictionary(int length, const QString& statusLabelContext) {
-    QString dictFilename = QString("dict_%1.txt").arg(length);
-    
-    // Get the application's directory
-    QString appDir = QCoreApplication::applicationDirPath();
-    QString dictPath = QDir(appDir).absoluteFilePath(dictFilename);
-
-    ui->statusLabel_auto->setText(statusLabelContext + "Loading dictionary " + dictFilename + "...");
-    QApplication::processEvents(); // Allow UI to update
-
-    // Try to open the file first to check for read access
-    QFile file(dictPath);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QString errorMsg = QString("Failed to open dictionary file: %1\nPath: %2\nError: %3")
-            .arg(dictFilename)
-            .arg(dictPath)
-            .arg(file.errorString());
-        ui->statusLabel_auto->setText(statusLabelContext + errorMsg);
-        QMessageBox::warning(this, "Dictionary Error", 
-            "Could not open dictionary file.\n\n" + errorMsg + 
-            "\n\nPlease ensure:\n"
-            "1. The file exists in the application directory\n"
-            "2. The file is readable\n"
-            "3. The file contains words of the specified length");
-        dictionaryLoaded = false;
-        return false;
-    }
-    file.close();
-
-    if (game.loadDictionary(q2s(dictPath))) {
-        ui->statusLabel_auto->setText(statusLabelContext + "Dictionary loaded. Building graph...");
-        QApplication::processEvents();
-        game.buildGraph();
-        ui->statusLabel_auto->setText(statusLabelContext + "Dictionary and graph ready for " + QString::number(length) + "-letter words.");
-        dictionaryLoaded = true;
-        return true;
+void MainWindow::onGraphProgress(int length, qulonglong wordsRead, qulonglong edgesFound, int percent) {
+    ui->statusLabel_auto->setText(QString("%1Loading dictionary dict_%2.txt... %3% (%4 words read, %5 edges found)")
+        .arg(loadStatusContext)
+        .arg(length)
+        .arg(percent)
+        .arg(wordsRead)
+        .arg(edgesFound));
+}
+
+/**
+ * @brief Takes a requested graph into use
+ * @param length The word length of the graph
+ * @param loadedGame The game with its dictionary and graph ready
+ * 
+ * The graph becomes automatic mode's graph if it matches the selected
+ * length there, in a single assignment on the GUI thread, after which the
+ * controls that need a graph are unlocked. A game in progress in play mode
+ * keeps its own graph. If the request came from the start game button, the
+ * game is started now.
+ */
+void MainWindow::onGraphReady(int length, std::shared_ptr<WordLadderGame> loadedGame) {
+    if (length == ui->wordLengthSpinBox_auto->value()) {
+        autoGame = loadedGame;
+        autoGame->setSearchStrategy(selectedSearchStrategy());
+    }
+
+    QString timing;
+    if (loadedGame->wasLoadedFromCache()) {
+        timing = QString(" (graph cache loaded in %1 ms)").arg(loadedGame->getLastLoadTimeMs(), 0, 'f', 1);
     } else {
-        QString errorMsg = QString("Failed to load dictionary: %1\nPath: %2").arg(dictFilename).arg(dictPath);
-        ui->statusLabel_auto->setText(statusLabelContext + errorMsg);
-        QMessageBox::warning(this, "Dictionary Error", 
-            "Could not process dictionary file.\n\n" + errorMsg + 
-            "\n\nPlease ensure:\n"
-            "1. The file exists in the application directory\n"
-            "2. The file is readable\n"
-            "3. The file contains words of the specified length");
-        dictionaryLoaded = false;
-        return false;
+        timing = QString(" (loaded in %1 ms, graph built in %2 ms)")
+                     .arg(loadedGame->getLastLoadTimeMs(), 0, 'f', 1)
+                     .arg(loadedGame->getLastBuildTimeMs(), 0, 'f', 1);
+    }
+    QString counters;
+    if (Instrumentation::enabled) {
+        const Instrumentation& record = loadedGame->getInstrumentation();
+        counters = QString("\nRead %1 KiB: %2 words kept, %3 rejected, %4 duplicates. %5 edges")
+            .arg(record.load.bytesRead / 1024.0, 0, 'f', 1)
+            .arg(record.load.wordsKept)
+            .arg(record.load.wordsRejected)
+            .arg(record.load.duplicates)
+            .arg(record.build.edgesCreated);
+        counters += record.load.fromCache
+            ? QString(" from the cache.")
+            : QString(" built on %1 threads, about %2 allocations.").arg(record.build.threads).arg(record.load.estimatedAllocations + record.build.estimatedAllocations);
+    }
+    ui->statusLabel_auto->setText(loadStatusContext + "Dictionary and graph ready for " + QString::number(length) + "-letter words." + timing
+        + QString(" %1 MiB of graphs resident.").arg(graphs.memoryUsage() / 1048576.0, 0, 'f', 1) + counters);
+    setLoadingState(false);
+
+    if (startGameAfterLoad) {
+        startGameAfterLoad = false;
+        if (length == ui->wordLengthSpinBox_play->value() && !playGame) {
+            startNewGame(loadedGame);
+        }
+    }
+}
+
+/**
+ * @brief Reports a dictionary that could not be loaded
+ * @param length The word length that was requested
+ * @param path The path of the dictionary file
+ */
+void MainWindow::onGraphFailed(int length, const QString& path) {
+    setLoadingState(false);
+    if (startGameAfterLoad) {
+        startGameAfterLoad = false;
+        resetPlayModeUI(false);
+    }
+
+    QString errorMsg = QString("Failed to load dictionary: dict_%1.txt\nPath: %2").arg(length).arg(path);
+    ui->statusLabel_auto->setText(loadStatusContext + errorMsg);
+    QMessageBox::warning(this, "Dictionary Error", 
+        "Could not process dictionary file.\n\n" + errorMsg + 
+        "\n\nPlease ensure:\n"
+        "1. The file exists in the application directory\n"
+        "2. The file is readable\n"
+        "3. The file contains words of the specified length");
+}
+
+/**
+ * @brief Enables or disables the controls that need a loaded graph
+ * @param loading Whether a load request is running
+ * 
+ * While loading, finding a path and starting a game are blocked. Afterwards
+ * path finding is allowed if automatic mode has a graph, and starting a game
+ * is allowed unless one is in progress.
+ */
+void MainWindow::setLoadingState(bool loading) {
+    loadInProgress = loading;
+    ui->findPathButton_auto->setEnabled(!loading && autoGame);
+    ui->startGameButton_play->setEnabled(!loading && !playGame);
+}
+
+/**
+ * @brief Gets the search strategy selected in automatic mode
+ * @return The strategy matching the search combo box
+ * 
+ * The combo box lists the algorithms in the order Bidirectional BFS, BFS,
+ * A* (landmarks).
+ */
+WordLadderGame::SearchStrategy MainWindow::selectedSearchStrategy() const {
+    switch (ui->searchStrategyComboBox_auto->currentIndex()) {
+    case 1:
+        return WordLadderGame::SearchStrategy::BreadthFirst;
+    case 2:
+        return WordLadderGame::SearchStrategy::LandmarkAStar;
+    default:
+        return WordLadderGame::SearchStrategy::Bidirectional;
     }
 }
 
@@ -122,28 +209,46 @@ bool MainWindow::loadAndBuildDictionary(int length, const QString& statusLabelCo
  * @brief Handles word length spinbox value changes in automatic mode
  * @param length The new word length value
  * 
- * Disables the find path button and requires dictionary reload when word length changes.
+ * Switches to the resident graph for the new length if there is one;
+ * otherwise the dictionary has to be loaded first.
  */
 void MainWindow::on_wordLengthSpinBox_auto_valueChanged(int length) {
-    // Automatically try to load dictionary when length changes
-    // Or, require user to click "Load Dictionary"
-    ui->findPathButton_auto->setEnabled(false); // Require reload if length changes
-    ui->statusLabel_auto->setText("Word length changed. Click 'Load Dictionary'.");
-    dictionaryLoaded = false;
+    autoGame = graphs.graphFor(length);
+    if (autoGame) {
+        autoGame->setSearchStrategy(selectedSearchStrategy());
+        ui->statusLabel_auto->setText(QString("[Auto Mode] Graph for %1-letter words is resident.").arg(length));
+    } else {
+        ui->statusLabel_auto->setText("Word length changed. Click 'Load Dictionary'.");
+    }
+    ui->findPathButton_auto->setEnabled(!loadInProgress && autoGame);
 }
 
 /**
  * @brief Handles the load dictionary button click in automatic mode
  * 
- * Attempts to load the dictionary for the current word length and enables
- * the find path button if successful.
+ * Starts loading the dictionary for the current word length; the find path
+ * button is enabled once the graph is ready.
  */
 void MainWindow::on_loadDictButton_auto_clicked() {
     int length = ui->wordLengthSpinBox_auto->value();
-    if (loadAndBuildDictionary(length, "[Auto Mode] ")) {
-        ui->findPathButton_auto->setEnabled(true);
-    } else {
-        ui->findPathButton_auto->setEnabled(false);
+    startGameAfterLoad = false; // This request supersedes one made by the start game button
+    loadAndBuildDictionary(length, "[Auto Mode] ");
+}
+
+/**
+ * @brief Handles search algorithm selection changes in automatic mode
+ * @param index The index of the selected algorithm
+ * 
+ * Only switches the strategy: every graph comes from the loader thread
+ * with its landmark tables already placed, so selecting A* does no search
+ * on the GUI thread. Dictionaries loaded later get the selected strategy
+ * as well.
+ */
+void MainWindow::on_searchStrategyComboBox_auto_currentIndexChanged(int index) {
+    Q_UNUSED(index); // The strategy is read back from the combo box
+    graphs.setSearchStrategy(selectedSearchStrategy());
+    if (autoGame) {
+        autoGame->setSearchStrategy(selectedSearchStrategy());
     }
 }
 
@@ -154,11 +259,11 @@ void MainWindow::on_loadDictButton_auto_clicked() {
  * Displays the path in the UI if found.
  */
 void MainWindow::on_findPathButton_auto_clicked() {
-    if (!dictionaryLoaded) {
+    if (!autoGame) {
         QMessageBox::information(this, "No Dictionary", "Please load a dictionary first.");
         return;
     }
-    if (game.getWordLength() != ui->wordLengthSpinBox_auto->value()){
+    if (autoGame->getWordLength() != ui->wordLengthSpinBox_auto->value()){
         QMessageBox::information(this, "Dictionary Mismatch", "Loaded dictionary is for a different word length. Please re-load.");
         ui->findPathButton_auto->setEnabled(false);
         return;
@@ -167,18 +272,18 @@ void MainWindow::on_findPathButton_auto_clicked() {
     std::string startWord = q2s(ui->startWordLineEdit_auto->text().toLower());
     std::string targetWord = q2s(ui->targetWordLineEdit_auto->text().toLower());
 
-    if (startWord.length() != game.getWordLength() || targetWord.length() != game.getWordLength()) {
-        QMessageBox::warning(this, "Word Length Mismatch", QString("Words must be %1 letters long.").arg(game.getWordLength()));
+    if (startWord.length() != autoGame->getWordLength() || targetWord.length() != autoGame->getWordLength()) {
+        QMessageBox::warning(this, "Word Length Mismatch", QString("Words must be %1 letters long.").arg(autoGame->getWordLength()));
         return;
     }
 
-    if (!game.isValidWord(startWord) || !game.isValidWord(targetWord)) {
+    if (!autoGame->isValidWord(startWord) || !autoGame->isValidWord(targetWord)) {
         QMessageBox::warning(this, "Invalid Word", "Start or target word not in the loaded dictionary.");
         return;
     }
 
     ui->pathListWidget_auto->clear();
-    std::vector<std::string> path = game.findShortestPath(startWord, targetWord);
+    std::vector<std::string> path = autoGame->findShortestPath(startWord, targetWord);
 
     if (path.empty()) {
         ui->pathListWidget_auto->addItem("No path found.");
@@ -187,13 +292,30 @@ void MainWindow::on_findPathButton_auto_clicked() {
             ui->pathListWidget_auto->addItem(s2q(word));
         }
     }
+
+    const SearchStats& stats = autoGame->getLastSearchStats();
+    if (Instrumentation::enabled) {
+        ui->statusLabel_auto->setText(QString("[Auto Mode] %1: %2 nodes dequeued, %3 edges scanned, peak frontier %4, about %5 allocations in %6 ms.")
+            .arg(ui->searchStrategyComboBox_auto->currentText())
+            .arg(stats.nodesExpanded)
+            .arg(stats.edgesScanned)
+            .arg(stats.peakFrontier)
+            .arg(stats.estimatedAllocations)
+            .arg(stats.elapsedMicros / 1000.0, 0, 'f', 3));
+    } else {
+        ui->statusLabel_auto->setText(QString("[Auto Mode] %1: %2 nodes expanded in %3 ms.")
+            .arg(ui->searchStrategyComboBox_auto->currentText())
+            .arg(stats.nodesExpanded)
+            .arg(stats.elapsedMicros / 1000.0, 0, 'f', 3));
+    }
 }
 
 /**
  * @brief Handles the start game button click in play mode
  * 
  * Validates player name and word length, then starts a new game with
- * randomly selected start and target words.
+ * randomly selected start and target words. If the dictionary for the
+ * selected length is not loaded yet, the game starts once loading finishes.
  */
 void MainWindow::on_startGameButton_play_clicked() {
     currentPlayerName_play = ui->playerNameLineEdit_play->text().trimmed();
@@ -208,43 +330,75 @@ void MainWindow::on_startGameButton_play_clicked() {
     }
 
     int length = ui->wordLengthSpinBox_play->value();
-    if (!dictionaryLoaded || game.getWordLength() != length) { // Load/reload if needed
-        if (!loadAndBuildDictionary(length, "[Play Mode] ")) {
-            resetPlayModeUI(false);
-            return;
-        }
+    std::shared_ptr<WordLadderGame> gameGraph = graphs.graphFor(length);
+    if (!gameGraph) { // Load if not resident
+        startGameAfterLoad = true; // Started by onGraphReady
+        ui->gameStatusLabel_play->setText("Loading dictionary...");
+        loadAndBuildDictionary(length, "[Play Mode] ");
+        return;
     }
+    startNewGame(gameGraph);
+}
 
-    int attempts = 0;
-    bool foundValidPair = false;
-
-    while (!foundValidPair) {
-        gameStartWord_play = game.getRandomWord();
-        gameTargetWord_play = game.getRandomWord();
-
-        // Make sure words are different
-        if (gameStartWord_play == gameTargetWord_play) {
-            attempts++;
-            continue;
-        }
+/**
+ * @brief Starts a play mode game
+ * @param gameGraph The graph to play on
+ * 
+ * Picks a random pair of words whose shortest ladder has the selected
+ * number of moves, or any connected pair, and fixes the target. Lengths
+ * beyond the ladder bound the loader found are turned down before any
+ * search, and a draw runs at most a few searches here; a possible length
+ * that the searches have not reached yet is offered again. The game
+ * keeps a handle on the graph it started with, so loading or evicting
+ * graphs in the meantime does not disturb it.
+ */
+void MainWindow::startNewGame(std::shared_ptr<WordLadderGame> gameGraph) {
+    playGame = std::move(gameGraph);
+
+    // The component index hands out a connected pair directly, and the
+    // ladder length index one at a set distance; one search outward from
+    // the target then yields the optimal number of moves and serves every
+    // hint of this game.
+    const int moves = ui->ladderLengthSpinBox_play->value();
+    bool foundValidPair = moves > 0
+        ? playGame->getRandomPairAtDistance(moves, gameStartWord_play, gameTargetWord_play)
+        : playGame->getRandomConnectedPair(gameStartWord_play, gameTargetWord_play);
+    foundValidPair = foundValidPair && playGame->setGameTarget(gameTargetWord_play);
+    if (foundValidPair) {
+        optimalMovesForCurrentGame_play = playGame->distanceToTarget(gameStartWord_play);
+        foundValidPair = optimalMovesForCurrentGame_play > 0;
+    }
 
-        // Check if there's a valid path between the words
-        std::vector<std::string> path = game.findShortestPath(gameStartWord_play, gameTargetWord_play);
-        if (!path.empty()) {
-            foundValidPair = true;
-            optimalMovesForCurrentGame_play = path.size() - 1;
+    // Both figures were found on the loader thread
+    const int longestLadder = playGame->getLongestLadder();
+    if (!foundValidPair && moves > 0 && longestLadder > 0) {
+        if (moves > playGame->getLadderBound()) {
+            QMessageBox::information(this, "No Such Puzzle",
+                QString("No two %1-letter words are exactly %2 moves apart.\n"
+                        "The longest ladder found has %3 moves.")
+                    .arg(playGame->getWordLength()).arg(moves).arg(longestLadder));
+            resetPlayModeUI(false);
+            return;
         }
-        attempts++;
-
-        if(attempts>10000) { // 10000 attempts to find valid game solution
-            break;
+        // The length is possible but the pairs searched so far lack it; each
+        // try searches a few more words
+        const QMessageBox::StandardButton retry = QMessageBox::question(this, "Puzzle Not Found Yet",
+            QString("No two %1-letter words exactly %2 moves apart were found yet.\n"
+                    "The longest ladder found so far has %3 moves.\n"
+                    "Search further?")
+                .arg(playGame->getWordLength()).arg(moves).arg(longestLadder));
+        if (retry == QMessageBox::Yes) {
+            startNewGame(playGame);
+        } else {
+            resetPlayModeUI(false);
         }
+        return;
     }
 
     if (!foundValidPair) {
         QMessageBox::critical(this, "Game Error", 
             "Could not find a valid word pair with a possible path.\n"
-            "The dictionary might be too small or disconnected.\n"
+            "The dictionary has no two words connected by a ladder.\n"
             "Try a different word length.");
         resetPlayModeUI(false);
         return;
@@ -277,13 +431,15 @@ void MainWindow::on_startGameButton_play_clicked() {
 void MainWindow::resetPlayModeUI(bool gameOngoing) {
     ui->playerNameLineEdit_play->setEnabled(!gameOngoing);
     ui->wordLengthSpinBox_play->setEnabled(!gameOngoing);
-    ui->startGameButton_play->setEnabled(!gameOngoing);
+    ui->ladderLengthSpinBox_play->setEnabled(!gameOngoing);
+    ui->startGameButton_play->setEnabled(!gameOngoing && !loadInProgress); // Not while a dictionary is loading
 
     ui->nextWordLineEdit_play->setEnabled(gameOngoing);
     ui->submitWordButton_play->setEnabled(gameOngoing);
     ui->hintButton_play->setEnabled(gameOngoing);
 
     if (!gameOngoing) {
+        playGame.reset(); // Release the graph of the finished game
         ui->startWordLabel_play->setText("Start: -");
         ui->targetWordLabel_play->setText("Target: -");
         updateCurrentWordDisplay("-");
@@ -305,17 +461,17 @@ void MainWindow::on_submitWordButton_play_clicked() {
     std::string currentWord = playerMoves_play.back();
     std::string nextWord_s = q2s(ui->nextWordLineEdit_play->text().toLower());
 
-    if (nextWord_s.length() != game.getWordLength()) {
-        ui->gameStatusLabel_play->setText(QString("Invalid word length. Must be %1 letters.").arg(game.getWordLength()));
+    if (nextWord_s.length() != playGame->getWordLength()) {
+        ui->gameStatusLabel_play->setText(QString("Invalid word length. Must be %1 letters.").arg(playGame->getWordLength()));
         return;
     }
 
-    if (!game.areWordsOneLetterApart(currentWord, nextWord_s)) {
+    if (!playGame->areWordsOneLetterApart(currentWord, nextWord_s)) {
         ui->gameStatusLabel_play->setText("Invalid move: Words must differ by exactly one letter.");
         return;
     }
 
-    if (!game.isValidWord(nextWord_s)) {
+    if (!playGame->isValidWord(nextWord_s)) {
         ui->gameStatusLabel_play->setText("Invalid move: '" + s2q(nextWord_s) + "' is not in the dictionary.");
         return;
     }
@@ -325,7 +481,14 @@ void MainWindow::on_submitWordButton_play_clicked() {
     ui->movesLabel_play->setText(QString("Moves: %1").arg(playerMoves_play.size() - 1));
     updateCurrentWordDisplay(nextWord_s);
     ui->nextWordLineEdit_play->clear();
-    ui->gameStatusLabel_play->setText("Good move!");
+    int movesLeft = playGame->distanceToTarget(nextWord_s);
+    if (playGame->isOptimalMove(currentWord, nextWord_s)) {
+        ui->gameStatusLabel_play->setText("Good move!");
+    } else if (movesLeft < 0) {
+        ui->gameStatusLabel_play->setText("Valid move, but the target can no longer be reached from here.");
+    } else {
+        ui->gameStatusLabel_play->setText(QString("Valid move, but not optimal. %1 moves to go.").arg(movesLeft));
+    }
 
 
     if (nextWord_s == gameTargetWord_play) {
@@ -339,7 +502,8 @@ void MainWindow::on_submitWordButton_play_clicked() {
 /**
  * @brief Handles the hint button click in play mode
  * 
- * Provides a hint by showing the next word in the optimal path.
+ * Provides a hint by showing the next word in the optimal path, read from
+ * the distance-to-target table computed when the game started.
  */
 void MainWindow::on_hintButton_play_clicked() {
     if (playerMoves_play.empty()) return;
@@ -352,17 +516,17 @@ void MainWindow::on_hintButton_play_clicked() {
     hintsUsed_play++;
     ui->hintsUsedLabel_play->setText(QString("Hints: %1").arg(hintsUsed_play));
 
-    std::vector<std::string> optimalPath = game.findShortestPath(currentWord, gameTargetWord_play);
+    // The distance table of this game gives the next optimal word by scanning neighbors
+    std::string optimalNextWord = playGame->nextOptimalWord(currentWord);
 
-    if (optimalPath.size() < 2) { // Path is just currentWord or empty
+    if (optimalNextWord.empty()) { // Target unreachable from here
         ui->gameStatusLabel_play->setText("Hint: No further path found or already at target.");
         updateCurrentWordDisplay(currentWord); // No specific letter to highlight
         return;
     }
 
-    std::string optimalNextWord = optimalPath[1];
     int diffIndex = -1;
-    for (int i = 0; i < game.getWordLength(); ++i) {
+    for (int i = 0; i < playGame->getWordLength(); ++i) {
         if (currentWord[i] != optimalNextWord[i]) {
             diffIndex = i;
             break;
@@ -371,9 +535,10 @@ void MainWindow::on_hintButton_play_clicked() {
 
     if (diffIndex != -1) {
         updateCurrentWordDisplay(currentWord, diffIndex);
-        ui->gameStatusLabel_play->setText(QString("Hint: Try changing the letter '%1' (to '%2').")
+        ui->gameStatusLabel_play->setText(QString("Hint: Try changing the letter '%1' (to '%2'). %3 moves to go.")
                                               .arg(currentWord[diffIndex])
-                                              .arg(optimalNextWord[diffIndex]));
+                                              .arg(optimalNextWord[diffIndex])
+                                              .arg(playGame->distanceToTarget(currentWord)));
     } else {
         // Should not happen if optimalNextWord is different and one letter apart
         updateCurrentWordDisplay(currentWord);
@@ -409,135 +574,179 @@ void MainWindow::updateCurrentWordDisplay(const std::string& word, int highlight
 }
 
 /**
- * @brief Saves the current game results to a CSV file
+ * @brief Saves the current game results to the player's history
  * 
- * Saves game statistics including start word, target word, number of moves,
- * optimal moves, hints used, and the complete path taken by the player.
+ * Appends one record holding the start and target words, the optimal
+ * moves, the hints used and the complete path taken by the player to the
+ * player's history log, and updates its summary index.
  */
 void MainWindow::saveGameResults() {
     if (currentPlayerName_play.isEmpty()) return;
 
-    QString filename = currentPlayerName_play + ".csv";
-    // For bundled apps, use QStandardPaths to find a writable location
-    // QString dataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
-    // QFile file(dataPath + "/" + filename);
-    // For simplicity now, current directory:
-    QFile file(filename);
-
-    bool fileExists = file.exists();
-    if (!file.open(QIODevice::Append | QIODevice::Text)) {
-        QMessageBox::warning(this, "Save Error", "Could not open file to save game data: " + filename);
+    // For simplicity the history lives in the current directory
+    QString filename = s2q(GameHistory::pathFor(q2s(currentPlayerName_play)));
+    GameHistory history;
+    if (!history.open(q2s(filename))) {
+        QMessageBox::warning(this, "Save Error", "Not a game history file: " + filename);
         return;
     }
-
-    QTextStream out(&file);
-    if (!fileExists) { // Add header if file is new
-        out << "DateTime,StartWord,TargetWord,UserMovesCount,OptimalMoves,HintsUsed,UserPath\n";
+    importLegacyHistory(currentPlayerName_play, history);
+
+    GameRecord record;
+    record.playedAt = gameStartTime_play.toSecsSinceEpoch();
+    record.startWord = gameStartWord_play;
+    record.targetWord = gameTargetWord_play;
+    record.path = playerMoves_play;
+    record.optimalMoves = optimalMovesForCurrentGame_play;
+    record.hintsUsed = hintsUsed_play;
+    if (!history.append(record)) {
+        QMessageBox::warning(this, "Save Error", "Could not save game data to: " + filename);
+        return;
     }
+    ui->gameStatusLabel_play->setText(ui->gameStatusLabel_play->text() + " Game data saved.");
+}
 
-    QStringList userPathList;
-    for(const std::string& move : playerMoves_play) {
-        userPathList.append(s2q(move));
+/**
+ * @brief Moves games from a player's old CSV file into their history
+ * @param playerName The player whose games to import
+ * @param history The player's history, opened
+ * 
+ * Earlier versions appended one CSV line per game to "<player>.csv", with
+ * the values prefixed by labels such as "Starting word: ". The file is
+ * imported once, while the history is still empty, and left in place.
+ */
+void MainWindow::importLegacyHistory(const QString& playerName, GameHistory& history) {
+    QFile file(playerName + ".csv");
+    if (history.summary().games != 0 || !file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return;
     }
 
-    out << gameStartTime_play.toString(Qt::ISODate) << ", Starting word: "
-        << s2q(gameStartWord_play) << ", Target word: "
-        << s2q(gameTargetWord_play) << ", Moves used: "
-        << playerMoves_play.size() - 1 << ", Optimal Moves: "
-        << optimalMovesForCurrentGame_play << ", Hints used: "
-        << hintsUsed_play << ","
-        << "\"" << userPathList.join(" -> ") << "\"\n"; // Enclose path in quotes if it contains commas
+    QTextStream in(&file);
+    in.readLine(); // Skip header
+    while (!in.atEnd()) {
+        QStringList fields = in.readLine().split(',');
+        if (fields.size() < 7) { // DateTime,Start,Target,UserMoves,OptimalMoves,Hints,Path
+            continue;
+        }
+        for (int i = 1; i < 6; ++i) {
+            fields[i] = fields[i].section(':', -1).trimmed(); // Drop any "Label: " prefix
+        }
 
-    file.close();
-    ui->gameStatusLabel_play->setText(ui->gameStatusLabel_play->text() + " Game data saved.");
+        GameRecord record;
+        record.playedAt = QDateTime::fromString(fields[0].trimmed(), Qt::ISODate).toSecsSinceEpoch();
+        record.startWord = q2s(fields[1].toLower());
+        record.targetWord = q2s(fields[2].toLower());
+        record.optimalMoves = fields[4].toInt();
+        record.hintsUsed = fields[5].toInt();
+        QString pathField = fields.mid(6).join(',');
+        pathField.remove('\"');
+        for (const QString& word : pathField.split(" -> ", Qt::SkipEmptyParts)) {
+            record.path.push_back(q2s(word.trimmed().toLower()));
+        }
+        history.append(record);
+    }
 }
 
 /**
  * @brief Handles word length spinbox value changes in play mode
  * @param length The new word length value
  * 
- * Disables game controls and requires dictionary reload when word length changes.
+ * Resets the game controls; "Start Game" then looks up the graph for the
+ * new length, loading it only if it is not resident.
  */
 void MainWindow::on_wordLengthSpinBox_play_valueChanged(int arg1) {
-    // Similar to auto mode, changing length should ideally reload dictionary
-    // For simplicity, we'll enforce "Start Game" to handle dictionary loading
     resetPlayModeUI(false); // Reset UI if length changes before starting
     ui->gameStatusLabel_play->setText("Word length selected. Click 'Start Game'.");
-    dictionaryLoaded = false; // Force reload on new game start
 }
 
 /**
  * @brief Handles the load stats button click in analytics mode
  * 
- * Loads and displays game statistics for the specified player.
+ * Shows the totals from the player's history index, which are read without
+ * touching the games, followed by the most recent games only.
  */
 void MainWindow::on_loadStatsButton_analytics_clicked() {
-    QString playerName = ui->playerNameLineEdit_analytics->text().trimmed();
-    if (playerName.isEmpty()) {
-        QMessageBox::warning(this, "Player Name", "Please enter a player name to load stats.");
+    QString playerName = analyticsPlayerName();
+    if (playerName.isEmpty()) return;
+
+    GameHistory history;
+    if (!history.open(GameHistory::pathFor(q2s(playerName)))) {
+        QMessageBox::warning(this, "Load Error", "Not a game history file for player: " + playerName);
         return;
     }
-    playerName.remove(QRegularExpression(QStringLiteral("[^a-zA-Z0-9_]")));
-
-
-    QString filename = playerName + ".csv";
-    QFile file(filename);
-
-    if (!file.exists() || !file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+    importLegacyHistory(playerName, history);
+    const GameHistory::Summary& totals = history.summary();
+    if (totals.games == 0) {
         ui->statsTextEdit_analytics->setText("No data found for player: " + playerName);
-        QMessageBox::information(this, "No Data", "No data file found or cannot read file for player: " + playerName);
+        QMessageBox::information(this, "No Data", "No games found for player: " + playerName);
         return;
     }
 
-    QTextStream in(&file);
-    QString allStatsContent = "Game History for " + playerName + ":\n\n";
-    std::set<std::string> uniqueWordsUsed; //std::set for automatic uniqueness of words.
-
-    int gamesPlayed = 0;
-    int totalUserMoves = 0;
-    int totalOptimalMoves = 0;
-    int totalHints = 0;
-
-    QString headerLine = in.readLine(); // Skip header
-    allStatsContent += headerLine + "\n-------------------------------------\n";
-
-
-    while (!in.atEnd()) {
-        QString line = in.readLine();
-        allStatsContent += line + "\n";
-        QStringList fields = line.split(',');
-
-        if (fields.size() >= 7) { // DateTime,Start,Target,UserMoves,OptimalMoves,Hints,Path
-            gamesPlayed++;
-            totalUserMoves += fields[3].toInt();
-            totalOptimalMoves += fields[4].toInt();
-            totalHints += fields[5].toInt();
-
-            // Parse user path for unique words
-            // Assuming path is fields[6] and looks like "\"WORD1 -> WORD2 -> WORD3\"
-            QString pathField = fields[6];
-            pathField.remove('\"'); // Remove quotes
-            QStringList pathWords = pathField.split(" -> ");
-            for (const QString& word : pathWords) {
-                if (!word.trimmed().isEmpty()) {
-                    uniqueWordsUsed.insert(q2s(word.trimmed().toLower()));
-                }
-            }
+    QString summary = QString("--- Summary for %1 ---\n").arg(playerName);
+    summary += QString("Total Games Played: %1\n").arg(totals.games);
+    summary += QString("Total Moves Made by User: %1\n").arg(totals.totalMoves);
+    summary += QString("Total Optimal Moves Possible: %1\n").arg(totals.totalOptimalMoves);
+    summary += QString("Total Hints Used: %1\n").arg(totals.totalHints);
+    summary += QString("Average Moves per Game: %1\n").arg(static_cast<double>(totals.totalMoves) / totals.games, 0, 'f', 2);
+    summary += QString("Average Hints per Game: %1\n").arg(static_cast<double>(totals.totalHints) / totals.games, 0, 'f', 2);
+    summary += QString("Unique Words Encountered by User: %1\n").arg(totals.uniqueWords);
+
+    const std::vector<GameRecord> games = history.recent(historyRowsShown);
+    QString log = QString("\n\n--- Last %1 of %2 Games ---\n").arg(games.size()).arg(totals.games);
+    log += "DateTime, Start, Target, Moves, Optimal, Hints, Path\n";
+    for (const GameRecord& game : games) {
+        QStringList path;
+        for (const std::string& word : game.path) {
+            path.append(s2q(word));
         }
+        log += QString("%1, %2, %3, %4, %5, %6, %7\n")
+                   .arg(QDateTime::fromSecsSinceEpoch(game.playedAt).toString(Qt::ISODate))
+                   .arg(s2q(game.startWord), s2q(game.targetWord))
+                   .arg(game.moves()).arg(game.optimalMoves).arg(game.hintsUsed)
+                   .arg(path.join(" -> "));
     }
-    file.close();
+    ui->statsTextEdit_analytics->setText(summary + log);
+}
 
-    QString summary = QString("\n--- Summary for %1 ---\n").arg(playerName);
-    summary += QString("Total Games Played: %1\n").arg(gamesPlayed);
-    summary += QString("Total Moves Made by User: %1\n").arg(totalUserMoves);
-    summary += QString("Total Optimal Moves Possible: %1\n").arg(totalOptimalMoves);
-    summary += QString("Total Hints Used: %1\n").arg(totalHints);
-    if (gamesPlayed > 0) {
-        summary += QString("Average Moves per Game: %1\n").arg(static_cast<double>(totalUserMoves) / gamesPlayed, 0, 'f', 2);
-        summary += QString("Average Hints per Game: %1\n").arg(static_cast<double>(totalHints) / gamesPlayed, 0, 'f', 2);
+/**
+ * @brief Handles the export CSV button click in analytics mode
+ * 
+ * Writes the player's whole history to a CSV file chosen by the user.
+ */
+void MainWindow::on_exportCsvButton_analytics_clicked() {
+    QString playerName = analyticsPlayerName();
+    if (playerName.isEmpty()) return;
+
+    GameHistory history;
+    if (!history.open(GameHistory::pathFor(q2s(playerName)))) {
+        QMessageBox::warning(this, "Export Error", "Not a game history file for player: " + playerName);
+        return;
+    }
+    importLegacyHistory(playerName, history);
+    if (history.summary().games == 0) {
+        QMessageBox::information(this, "No Data", "No games found for player: " + playerName);
+        return;
     }
-    summary += QString("Unique Words Encountered by User: %1\n").arg(uniqueWordsUsed.size());
 
+    QString csvPath = QFileDialog::getSaveFileName(this, "Export Game History", playerName + "_history.csv",
+                                                   "CSV files (*.csv)");
+    if (csvPath.isEmpty()) return;
+    if (!history.exportCsv(q2s(csvPath))) {
+        QMessageBox::warning(this, "Export Error", "Could not write file: " + csvPath);
+        return;
+    }
+    ui->statsTextEdit_analytics->append(QString("\nExported %1 games to %2").arg(history.summary().games).arg(csvPath));
+}
 
-    ui->statsTextEdit_analytics->setText(summary + "\n\n--- Full Game Log ---\n" + allStatsContent);
+/**
+ * @brief Reads the player name entered in analytics mode
+ * @return The name restricted to file-safe characters, or empty after warning the user
+ */
+QString MainWindow::analyticsPlayerName() {
+    QString playerName = ui->playerNameLineEdit_analytics->text().trimmed();
+    playerName.remove(QRegularExpression(QStringLiteral("[^a-zA-Z0-9_]")));
+    if (playerName.isEmpty()) {
+        QMessageBox::warning(this, "Player Name", "Please enter a player name to load stats.");
+    }
+    return playerName;
 }
@@ -6,7 +6,10 @@
 #include <vector>
 #include <string>
 #include <QDateTime>
+#include <memory>
 #include "wordladdergame.h"
+#include "graphmanager.h"
+#include "gamehistory.h"
 
 QT_BEGIN_NAMESPACE
 namespace Ui { class MainWindow; }
@@ -17,7 +20,10 @@ QT_END_NAMESPACE
  * @brief The main window class for the Word Ladder Game application
  * 
  * This class handles the user interface and game logic for both automatic and play modes.
- * It manages dictionary loading, word path finding, and game state.
+ * It manages dictionary loading, word path finding, and game state. Graphs for
+ * several word lengths are kept resident by a GraphManager, which loads them
+ * on a worker thread, so the window stays responsive and switching between
+ * lengths or tabs does not rebuild anything.
  */
 class MainWindow : public QMainWindow {
     Q_OBJECT
@@ -52,6 +58,12 @@ private slots:
      */
     void on_wordLengthSpinBox_auto_valueChanged(int arg1);
 
+    /**
+     * @brief Handles search algorithm selection changes in automatic mode
+     * @param index The index of the selected algorithm
+     */
+    void on_searchStrategyComboBox_auto_currentIndexChanged(int index);
+
     // Play Mode
     /**
      * @brief Handles the start game button click in play mode
@@ -80,10 +92,45 @@ private slots:
      */
     void on_loadStatsButton_analytics_clicked();
 
+    /**
+     * @brief Handles the export CSV button click in analytics mode
+     */
+    void on_exportCsvButton_analytics_clicked();
+
+    // Dictionary loading
+    /**
+     * @brief Shows the progress of the requested graph
+     * @param length The word length being loaded
+     * @param wordsRead Words accepted from the dictionary so far
+     * @param edgesFound Edges found by the graph build so far
+     * @param percent Overall completion, 0 to 100
+     */
+    void onGraphProgress(int length, qulonglong wordsRead, qulonglong edgesFound, int percent);
+
+    /**
+     * @brief Takes a requested graph into use
+     * @param length The word length of the graph
+     * @param loadedGame The game with its dictionary and graph ready
+     */
+    void onGraphReady(int length, std::shared_ptr<WordLadderGame> loadedGame);
+
+    /**
+     * @brief Reports a dictionary that could not be loaded
+     * @param length The word length that was requested
+     * @param path The path of the dictionary file
+     */
+    void onGraphFailed(int length, const QString& path);
+
 private:
     Ui::MainWindow *ui;
-    WordLadderGame game;
-    bool dictionaryLoaded; // Flag to track if a dictionary is loaded for current game logic
+    GraphManager graphs; // Resident graphs by word length
+    std::shared_ptr<WordLadderGame> autoGame; // Graph used by automatic mode, null until loaded
+    std::shared_ptr<WordLadderGame> playGame; // Graph of the game in progress, kept even if evicted
+
+    // Dictionary loading
+    bool loadInProgress; // Whether a requested graph is still loading
+    QString loadStatusContext; // Status message prefix of the newest request
+    bool startGameAfterLoad; // Start a play mode game once the requested graph is ready
 
     // Play Mode
     QString currentPlayerName_play; // Player name
@@ -94,6 +141,9 @@ private:
     QDateTime gameStartTime_play; // Time
     int optimalMovesForCurrentGame_play; // Optimal number of moves
 
+    // Analytics Mode
+    static constexpr size_t historyRowsShown = 50; // Most recent games listed under the totals
+
     /**
      * @brief Updates the current word display in the UI
      * @param word The word to display
@@ -102,10 +152,23 @@ private:
     void updateCurrentWordDisplay(const std::string& word, int highlightIndex = -1);
 
     /**
-     * @brief Saves the current game results to a CSV file
+     * @brief Saves the current game results to the player's history
      */
     void saveGameResults();
 
+    /**
+     * @brief Moves games from a player's old CSV file into their history
+     * @param playerName The player whose games to import
+     * @param history The player's history, opened
+     */
+    void importLegacyHistory(const QString& playerName, GameHistory& history);
+
+    /**
+     * @brief Reads the player name entered in analytics mode
+     * @return The name restricted to file-safe characters, or empty after warning the user
+     */
+    QString analyticsPlayerName();
+
     /**
      * @brief Resets the play mode UI elements
      * @param gameOngoing Whether a game is currently in progress
@@ -113,12 +176,32 @@ private:
     void resetPlayModeUI(bool gameOngoing);
 
     /**
-     * @brief Loads and builds the dictionary for the specified word length
+     * @brief Requests the graph for the specified word length
      * @param length The word length to load
      * @param modePrefix The prefix for status messages
-     * @return true if dictionary was loaded successfully, false otherwise
+     *
+     * Returns immediately; the result arrives through onGraphReady, at once
+     * if the graph is resident, or through onGraphFailed.
+     */
+    void loadAndBuildDictionary(int length, const QString& modePrefix);
+
+    /**
+     * @brief Enables or disables the controls that need a loaded graph
+     * @param loading Whether a load request is running
+     */
+    void setLoadingState(bool loading);
+
+    /**
+     * @brief Gets the search strategy selected in automatic mode
+     * @return The strategy matching the search combo box
+     */
+    WordLadderGame::SearchStrategy selectedSearchStrategy() const;
+
+    /**
+     * @brief Starts a play mode game
+     * @param gameGraph The graph to play on
      */
-    bool loadAndBuildDictionary(int length, const QString& modePrefix);
+    void startNewGame(std::shared_ptr<WordLadderGame> gameGraph);
 };
 
 #endif // MAINWINDOW_H
@@ -0,0 +1,73 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+#include <cstddef>
+
+/**
+ * @class MappedFile
+ * @brief A read-only memory mapping of a whole file
+ *
+ * Maps the file into the address space so its contents can be scanned in
+ * place without copying through stream buffers. Uses mmap on POSIX systems
+ * and file mapping objects on Windows. An empty file opens successfully
+ * with a null data pointer and a size of zero.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Constructs an unopened mapping
+     */
+    MappedFile() = default;
+
+    /**
+     * @brief Unmaps the file if it is open
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Maps a file read-only
+     * @param path The path of the file to map
+     * @return true if the file was opened and mapped, false otherwise
+     *
+     * Any previously mapped file is closed first.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Unmaps the file and releases its handles
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a file is currently mapped
+     * @return true if open succeeded and close has not been called since
+     */
+    bool isOpen() const { return opened; }
+
+    /**
+     * @brief Gets the mapped bytes
+     * @return A pointer to the start of the file contents, or nullptr if empty
+     */
+    const char* data() const { return bytes; }
+
+    /**
+     * @brief Gets the size of the mapped file
+     * @return The file size in bytes
+     */
+    size_t size() const { return length; }
+
+private:
+    const char* bytes = nullptr; ///< Start of the mapping
+    size_t length = 0;           ///< Size of the mapping in bytes
+    bool opened = false;         ///< Whether a file is currently mapped
+#ifdef _WIN32
+    void* fileHandle = nullptr;    ///< Windows file handle
+    void* mappingHandle = nullptr; ///< Windows file mapping handle
+#endif
+};
+
+#endif // MAPPEDFILE_H
@@ -0,0 +1,184 @@
+#ifndef PACKEDWORD_H
+#define PACKEDWORD_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+/**
+ * @namespace PackedWord
+ * @brief Fixed-width integer encoding of lowercase words
+ *
+ * Every word of a dictionary has the same length, so a word fits in one
+ * 64-bit key at 5 bits per letter ('a' = 1 ... 'z' = 26), first letter in
+ * the most significant lane. Numeric order of keys of equal length is
+ * alphabetical order. Two words differ at a position exactly when the
+ * corresponding lane of their XOR is non-zero, so comparing words is a
+ * handful of integer operations with no per-letter branches.
+ */
+namespace PackedWord {
+
+using Key = std::uint64_t;
+
+constexpr int bitsPerLetter = 5;  ///< Width of one letter lane
+constexpr size_t maxLength = 12;  ///< Longest word that fits in a key
+constexpr Key letterMask = 0x1F;  ///< Mask of a single lane
+
+/**
+ * @brief Gets the shift of the lane holding a letter
+ * @param position The letter position, 0 being the first letter
+ * @param length The word length
+ * @return The bit offset of the lane
+ */
+constexpr int laneShift(size_t position, size_t length) {
+    return static_cast<int>((length - 1 - position) * bitsPerLetter);
+}
+
+/**
+ * @brief Gets a key with the lowest bit of every lane set
+ * @param length The word length
+ * @return The lane marker mask used by the comparison kernels
+ */
+constexpr Key laneLowBits(size_t length) {
+    Key bits = 0;
+    for (size_t i = 0; i < length; ++i) {
+        bits = (bits << bitsPerLetter) | 1;
+    }
+    return bits;
+}
+
+/**
+ * @brief Packs a word into a key
+ * @param word The word's letters
+ * @param length The number of letters, at most maxLength
+ * @param key Receives the packed key
+ * @return true if every character is a lowercase letter, false otherwise
+ */
+inline bool pack(const char* word, size_t length, Key& key) {
+    if (length > maxLength) {
+        return false;
+    }
+    Key packed = 0;
+    for (size_t i = 0; i < length; ++i) {
+        const unsigned letter = static_cast<unsigned char>(word[i]) - ('a' - 1);
+        if (letter - 1 >= 26) {
+            return false;
+        }
+        packed = (packed << bitsPerLetter) | letter;
+    }
+    key = packed;
+    return true;
+}
+
+/**
+ * @brief Packs a word into a key
+ * @param word The word to pack
+ * @param key Receives the packed key
+ * @return true if every character is a lowercase letter, false otherwise
+ */
+inline bool pack(const std::string& word, Key& key) {
+    return pack(word.data(), word.length(), key);
+}
+
+/**
+ * @brief Unpacks a key into a character buffer
+ * @param key The packed key
+ * @param length The word length
+ * @param out Receives the lowercase word, without a terminator
+ */
+inline void unpack(Key key, size_t length, char* out) {
+    for (size_t i = length; i-- > 0; key >>= bitsPerLetter) {
+        out[i] = static_cast<char>('a' - 1 + (key & letterMask));
+    }
+}
+
+/**
+ * @brief Unpacks a key into a word
+ * @param key The packed key
+ * @param length The word length
+ * @return The lowercase word
+ */
+inline std::string unpack(Key key, size_t length) {
+    std::string word(length, '\0');
+    unpack(key, length, &word[0]);
+    return word;
+}
+
+/**
+ * @brief Marks the lanes in which two keys differ
+ * @param a The first key
+ * @param b The second key
+ * @param lowBits laneLowBits() of the word length
+ * @return A key with the lowest bit of each differing lane set
+ *
+ * Folds every lane of the XOR onto its lowest bit. Bits shifted in from the
+ * lane above land on higher bits of the lane and are masked off.
+ */
+inline Key differingLanes(Key a, Key b, Key lowBits) {
+    const Key x = a ^ b;
+    Key folded = x | (x >> 1); // Bits 0-1 of each lane
+    folded |= folded >> 2;     // Bits 0-3
+    folded |= x >> 4;          // Bits 0-4
+    return folded & lowBits;
+}
+
+/**
+ * @brief Counts the set bits of a 64-bit word
+ * @param bits The word
+ * @return The number of set bits
+ *
+ * Uses the compiler builtin where there is one, and a branch-free SWAR
+ * count otherwise (e.g. on MSVC, whose intrinsic needs a POPCNT CPU).
+ */
+inline int popcount64(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(bits);
+#else
+    bits -= (bits >> 1) & 0x5555555555555555ULL;
+    bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+    bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<int>((bits * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * @brief Gets the index of the lowest set bit of a 64-bit word
+ * @param bits The word, not 0
+ * @return The number of zero bits below the lowest set bit
+ */
+inline int countTrailingZeros64(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(bits);
+#else
+    return popcount64((bits & (~bits + 1)) - 1); // Ones below the lowest set bit
+#endif
+}
+
+/**
+ * @brief Counts the positions at which two words differ
+ * @param a The first key
+ * @param b The second key
+ * @param lowBits laneLowBits() of the word length
+ * @return The Hamming distance of the two words
+ */
+inline int differingLetters(Key a, Key b, Key lowBits) {
+    return popcount64(differingLanes(a, b, lowBits));
+}
+
+/**
+ * @brief Checks whether two words differ in exactly one letter
+ * @param a The first key
+ * @param b The second key
+ * @param lowBits laneLowBits() of the word length
+ * @return true if exactly one lane differs
+ *
+ * A single set bit is detected with x & (x - 1), so no population count is needed.
+ */
+inline bool oneLetterApart(Key a, Key b, Key lowBits) {
+    const Key lanes = differingLanes(a, b, lowBits);
+    return lanes != 0 && (lanes & (lanes - 1)) == 0;
+}
+
+} // namespace PackedWord
+
+#endif // PACKEDWORD_H
@@ -0,0 +1,161 @@
+#ifndef PACKEDWORDTABLE_H
+#define PACKEDWORDTABLE_H
+
+#include "packedword.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <limits>
+
+/**
+ * @class PackedWordTable
+ * @brief Open-addressing hash table from packed words to node IDs
+ *
+ * Keys and IDs sit in two parallel power-of-two arrays probed linearly, so
+ * a lookup is one multiply, a shift and usually a single cache line of
+ * keys; the ID array is only touched on a hit. Key 0 marks an empty slot,
+ * which no packed word can be since every letter lane is non-zero.
+ *
+ * The table is kept at most half full. Most lookups made while generating
+ * neighbors miss, and a miss scans to the next empty slot, so a low load
+ * factor matters more here than the extra slots.
+ */
+class PackedWordTable {
+public:
+    using NodeId = std::uint32_t;
+    static constexpr NodeId notFound = std::numeric_limits<NodeId>::max(); ///< Result of a failed lookup
+
+    /**
+     * @brief Fills the table with a key list, each key's ID being its index
+     * @param words The packed words; a repeated key keeps its last index
+     */
+    void build(const std::vector<PackedWord::Key>& words) {
+        count = 0;
+        allocate(words.size());
+        for (size_t i = 0; i < words.size(); ++i) {
+            count += place(words[i], static_cast<NodeId>(i)) ? 1 : 0;
+        }
+    }
+
+    /**
+     * @brief Adds a key or changes the ID of a present one
+     * @param key The packed word
+     * @param id The node ID to file it under
+     */
+    void insert(PackedWord::Key key, NodeId id) {
+        if (2 * (count + 1) > keys.size()) {
+            std::vector<PackedWord::Key> oldKeys;
+            std::vector<NodeId> oldIds;
+            oldKeys.swap(keys);
+            oldIds.swap(ids);
+            allocate(count + 1);
+            for (size_t slot = 0; slot < oldKeys.size(); ++slot) {
+                if (oldKeys[slot] != 0) {
+                    place(oldKeys[slot], oldIds[slot]);
+                }
+            }
+        }
+        if (place(key, id)) {
+            ++count;
+        }
+    }
+
+    /**
+     * @brief Looks a key up
+     * @param key The packed word
+     * @return Its node ID, or notFound
+     */
+    NodeId find(PackedWord::Key key) const {
+        if (keys.empty()) {
+            return notFound;
+        }
+        for (size_t slot = home(key); ; slot = (slot + 1) & mask) {
+            const PackedWord::Key stored = keys[slot];
+            if (stored == key) {
+                return ids[slot];
+            }
+            if (stored == 0) {
+                return notFound;
+            }
+        }
+    }
+
+    /**
+     * @brief Removes every key and releases the arrays
+     */
+    void clear() {
+        std::vector<PackedWord::Key>().swap(keys);
+        std::vector<NodeId>().swap(ids);
+        count = 0;
+        mask = 0;
+        shift = 64;
+    }
+
+    /**
+     * @brief Gets the number of keys
+     * @return The number of distinct keys inserted
+     */
+    size_t size() const { return count; }
+
+    /**
+     * @brief Gets the memory held by the table
+     * @return The allocated bytes of both slot arrays
+     */
+    size_t memoryUsage() const {
+        return keys.capacity() * sizeof(PackedWord::Key) + ids.capacity() * sizeof(NodeId);
+    }
+
+private:
+    /**
+     * @brief Sizes empty slot arrays for a number of keys
+     * @param keyCount The keys the table must hold at most half full
+     */
+    void allocate(size_t keyCount) {
+        size_t slots = 16;
+        shift = 60;
+        while (slots < 2 * keyCount) {
+            slots *= 2;
+            --shift;
+        }
+        keys.assign(slots, 0);
+        ids.assign(slots, notFound);
+        mask = slots - 1;
+    }
+
+    /**
+     * @brief Gets the first slot probed for a key
+     * @param key The packed word
+     * @return The slot index
+     *
+     * Fibonacci hashing: the top bits of the key times 2^64 / phi, which
+     * spreads keys differing only in their low lanes across the table.
+     */
+    size_t home(PackedWord::Key key) const {
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> shift);
+    }
+
+    /**
+     * @brief Writes a key into its slot without growing the table
+     * @param key The packed word
+     * @param id The node ID
+     * @return true if the key was new
+     */
+    bool place(PackedWord::Key key, NodeId id) {
+        size_t slot = home(key);
+        while (keys[slot] != 0 && keys[slot] != key) {
+            slot = (slot + 1) & mask;
+        }
+        const bool added = keys[slot] == 0;
+        keys[slot] = key;
+        ids[slot] = id;
+        return added;
+    }
+
+    std::vector<PackedWord::Key> keys; ///< Key of each slot, 0 if empty
+    std::vector<NodeId> ids;           ///< Node ID of each occupied slot
+    size_t count = 0;                  ///< Number of occupied slots
+    size_t mask = 0;                   ///< Slot count minus one
+    int shift = 64;                    ///< 64 minus log2 of the slot count
+};
+
+#endif // PACKEDWORDTABLE_H
@@ -0,0 +1,201 @@
+#ifndef SEARCHCONTEXT_H
+#define SEARCHCONTEXT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include "instrumentation.h"
+
+/**
+ * @class SearchContext
+ * @brief Reusable scratch state for graph searches
+ *
+ * Holds flat, node-ID-indexed visited and parent arrays for two search
+ * sides (forward and backward), closed marks, path costs and an open list
+ * for best-first searches, plus frontier and path buffers. Instead of
+ * clearing the arrays between queries, every query bumps an epoch counter:
+ * a node counts as visited on a side only if its stamp equals the current
+ * epoch. Once the buffers have grown to the graph size, a query performs
+ * no heap allocation.
+ *
+ * A context may be used by one search at a time. Give each thread its own
+ * context to search a shared graph concurrently.
+ */
+class SearchContext {
+public:
+    using NodeId = std::uint32_t;
+    static constexpr NodeId invalidNode = std::numeric_limits<NodeId>::max();
+
+    /**
+     * @brief The two directions of a search
+     */
+    enum Side { Forward = 0, Backward = 1 };
+
+    /**
+     * @brief Prepares the context for a new query
+     * @param nodeCount The number of nodes in the graph being searched
+     *
+     * Grows the arrays if the graph is larger than any seen before, then
+     * invalidates all previous marks by advancing the epoch. The arrays are
+     * only wiped when the epoch counter wraps around.
+     */
+    void beginQuery(size_t nodeCount) {
+        stats = SearchStats();
+        if (stamps[Forward].size() < nodeCount) {
+            WL_INSTRUMENT(stats.estimatedAllocations += shortArrayCount(nodeCount));
+            for (int side = 0; side < 2; ++side) {
+                stamps[side].resize(nodeCount, 0);
+                parents[side].resize(nodeCount, invalidNode);
+                frontiers[side].reserve(nodeCount);
+            }
+            closedStamps.resize(nodeCount, 0);
+            costs.resize(nodeCount, 0);
+            open.reserve(nodeCount);
+            nextFrontier.reserve(nodeCount);
+            queue.reserve(nodeCount);
+            path.reserve(nodeCount);
+        }
+        if (++epoch == 0) {
+            for (int side = 0; side < 2; ++side) {
+                std::fill(stamps[side].begin(), stamps[side].end(), 0);
+            }
+            std::fill(closedStamps.begin(), closedStamps.end(), 0);
+            epoch = 1;
+        }
+        for (int side = 0; side < 2; ++side) {
+            frontiers[side].clear();
+        }
+        nextFrontier.clear();
+        queue.clear();
+        path.clear();
+        open.clear();
+    }
+
+    /**
+     * @brief Checks whether a side has reached a node in the current query
+     * @param side The search side
+     * @param node The node to check
+     * @return true if the node was visited on that side
+     */
+    bool isVisited(Side side, NodeId node) const {
+        return stamps[side][node] == epoch;
+    }
+
+    /**
+     * @brief Marks a node as reached on a side
+     * @param side The search side
+     * @param node The node being reached
+     * @param parent The node it was reached from (the node itself for a root)
+     * @return true if the node was newly visited, false if it was already visited
+     */
+    bool visit(Side side, NodeId node, NodeId parent) {
+        if (stamps[side][node] == epoch) {
+            return false;
+        }
+        stamps[side][node] = epoch;
+        parents[side][node] = parent;
+        return true;
+    }
+
+    /**
+     * @brief Gets the node a visited node was reached from
+     * @param side The search side
+     * @param node A node visited on that side in the current query
+     * @return The parent node
+     */
+    NodeId parent(Side side, NodeId node) const {
+        return parents[side][node];
+    }
+
+    /**
+     * @brief Changes the parent of a node already visited on a side
+     * @param side The search side
+     * @param node A node visited on that side in the current query
+     * @param parent The node it is now reached from
+     */
+    void setParent(Side side, NodeId node, NodeId parent) {
+        parents[side][node] = parent;
+    }
+
+    /**
+     * @brief Marks a node as settled (its shortest distance is final)
+     * @param node The node to close
+     * @return true if the node was newly closed, false if it was already closed
+     */
+    bool close(NodeId node) {
+        if (closedStamps[node] == epoch) {
+            return false;
+        }
+        closedStamps[node] = epoch;
+        return true;
+    }
+
+    /**
+     * @brief Checks whether a node has been settled in the current query
+     * @param node The node to check
+     * @return true if the node is closed
+     */
+    bool isClosed(NodeId node) const {
+        return closedStamps[node] == epoch;
+    }
+
+    /**
+     * @brief Gets the memory held by the scratch buffers
+     * @return The allocated bytes of all per-node and per-query arrays
+     */
+    size_t memoryUsage() const {
+        size_t bytes = (frontiers[0].capacity() + frontiers[1].capacity() + nextFrontier.capacity()
+                        + queue.capacity() + path.capacity() + neighbors.capacity()
+                        + parents[0].capacity() + parents[1].capacity())
+                       * sizeof(NodeId);
+        bytes += (costs.capacity() + stamps[0].capacity() + stamps[1].capacity() + closedStamps.capacity())
+                 * sizeof(std::uint32_t);
+        bytes += open.capacity() * sizeof(OpenEntry);
+        return bytes;
+    }
+
+    /**
+     * @struct OpenEntry
+     * @brief An entry of the best-first open list
+     */
+    struct OpenEntry {
+        std::uint32_t estimate; ///< Path cost plus heuristic (f)
+        std::uint32_t cost;     ///< Path cost from the start (g)
+        NodeId node;            ///< The node this entry refers to
+    };
+
+    std::vector<NodeId> frontiers[2]; ///< Current level of each side
+    std::vector<NodeId> nextFrontier; ///< Level being built by the expanding side
+    std::vector<NodeId> queue;        ///< FIFO storage for one-directional searches
+    std::vector<NodeId> path;         ///< Node IDs of the last path found
+    std::vector<NodeId> neighbors;    ///< Neighbors generated for the node being expanded, in implicit graphs
+    std::vector<std::uint32_t> costs; ///< Best known path cost of each forward-visited node
+    std::vector<OpenEntry> open;      ///< Binary heap of nodes awaiting expansion
+    SearchStats stats;                ///< Statistics of the current query
+
+private:
+    /**
+     * @brief Counts the arrays that beginQuery must reallocate for a graph
+     * @param nodeCount The number of nodes in the graph
+     * @return The number of arrays whose capacity is below nodeCount
+     */
+    size_t shortArrayCount(size_t nodeCount) const {
+        size_t count = 0;
+        for (int side = 0; side < 2; ++side) {
+            count += (stamps[side].capacity() < nodeCount) + (parents[side].capacity() < nodeCount)
+                   + (frontiers[side].capacity() < nodeCount);
+        }
+        count += (closedStamps.capacity() < nodeCount) + (costs.capacity() < nodeCount) + (open.capacity() < nodeCount)
+               + (nextFrontier.capacity() < nodeCount) + (queue.capacity() < nodeCount) + (path.capacity() < nodeCount);
+        return count;
+    }
+
+    std::vector<std::uint32_t> stamps[2]; ///< Epoch at which each node was last visited
+    std::vector<NodeId> parents[2];       ///< Parent of each visited node
+    std::vector<std::uint32_t> closedStamps; ///< Epoch at which each node was last closed
+    std::uint32_t epoch = 0;              ///< Identifier of the current query
+};
+
+#endif // SEARCHCONTEXT_H
@@ -0,0 +1,82 @@
+#ifndef WORDARENA_H
+#define WORDARENA_H
+
+#include "packedword.h"
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class WordArena
+ * @brief The text of every word of one length, stored back to back
+ *
+ * All words of a dictionary have the same length, so the arena is a single
+ * character array in which word i starts at i * length, with no separators,
+ * terminators or per-word headers. A word is handed out as a string_view
+ * into the array, so the game keeps one copy of each word's text however
+ * many tables refer to it, and replacing a dictionary frees all of it in
+ * one step.
+ *
+ * Views stay valid until the next append(), assign() or clear().
+ */
+class WordArena {
+public:
+    /**
+     * @brief Replaces the contents with the words of a key list
+     * @param keys The packed words; word i is keys[i]
+     * @param length The word length
+     */
+    void assign(const std::vector<PackedWord::Key>& keys, size_t length) {
+        std::vector<char> fresh(keys.size() * length);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            PackedWord::unpack(keys[i], length, fresh.data() + i * length);
+        }
+        text.swap(fresh);
+        width = length;
+    }
+
+    /**
+     * @brief Adds one word after the last
+     * @param key The packed word, of the arena's length
+     */
+    void append(PackedWord::Key key) {
+        const size_t offset = text.size();
+        text.resize(offset + width);
+        PackedWord::unpack(key, width, text.data() + offset);
+    }
+
+    /**
+     * @brief Gets a word
+     * @param id The word's index, below size()
+     * @return A view of the word's text
+     */
+    std::string_view word(size_t id) const {
+        return std::string_view(text.data() + id * width, width);
+    }
+
+    /**
+     * @brief Gets the number of words
+     * @return The number of words stored
+     */
+    size_t size() const { return width == 0 ? 0 : text.size() / width; }
+
+    /**
+     * @brief Frees every word
+     */
+    void clear() {
+        std::vector<char>().swap(text);
+        width = 0;
+    }
+
+    /**
+     * @brief Gets the memory held by the arena
+     * @return The allocated bytes of the character array
+     */
+    size_t memoryUsage() const { return text.capacity(); }
+
+private:
+    std::vector<char> text; ///< Every word's letters, word i at i * width
+    size_t width = 0;       ///< Length of each word
+};
+
+#endif // WORDARENA_H
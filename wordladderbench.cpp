@@ -0,0 +1,627 @@
+#include "wordladdergame.h"
+#include "searchcontext.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <random>
+#include <thread>
+#include <algorithm>
+#include <filesystem>
+#include <chrono>
+#include <ctime>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+/**
+ * @brief Relative frequencies of the letters 'a' to 'z' in English text
+ *
+ * Skewed letters give synthetic dictionaries a realistic share of words one
+ * letter apart; uniformly random words would hardly ever be neighbors.
+ */
+const double letterWeights[26] = {
+    8.2, 1.5, 2.8, 4.3, 12.7, 2.2, 2.0, 6.1, 7.0, 0.2, 0.8, 4.0, 2.4,
+    6.7, 7.5, 1.9, 0.1, 6.0, 6.3, 9.1, 2.8, 1.0, 2.4, 0.2, 2.0, 0.1
+};
+
+/**
+ * @struct Options
+ * @brief Command line settings of a benchmark run
+ */
+struct Options {
+    std::vector<size_t> wordCounts{10000, 100000}; ///< Dictionary sizes to generate
+    std::vector<int> lengths{4, 6, 8};             ///< Word lengths to generate
+    int alphabet = 26;       ///< Letters used by synthetic words; fewer letters give denser graphs
+    std::vector<WordLadderGame::GraphMode> modes{WordLadderGame::GraphMode::Materialized,
+                                                 WordLadderGame::GraphMode::Implicit}; ///< Graph modes measured per dictionary
+    size_t queries = 200;    ///< Searches timed per strategy
+    unsigned threads = 0;    ///< Build threads, 0 for all hardware threads
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency()); ///< Upper end of --scaling
+    int runs = 3;            ///< Repetitions per measurement; the best is kept
+    unsigned seed = 12345;   ///< Seed of the dictionary and query generators
+    bool scaling = false;    ///< Run the build scaling report instead of the suite
+    std::string jsonPath;    ///< Where to write JSON results, "-" for standard output
+    std::string label;       ///< Free-form label stored with the results
+};
+
+/**
+ * @struct SearchResult
+ * @brief Timings of one search strategy over the query set
+ */
+struct SearchResult {
+    std::string strategy;        ///< Strategy name
+    double meanMicros = 0.0;     ///< Mean time per query
+    double p50Micros = 0.0;      ///< Median time per query
+    double p95Micros = 0.0;      ///< 95th percentile time per query
+    double meanExpanded = 0.0;   ///< Mean nodes expanded per query
+    double queriesPerSecond = 0.0; ///< Throughput on one thread
+};
+
+/**
+ * @struct CaseResult
+ * @brief Measurements of one synthetic dictionary
+ */
+struct CaseResult {
+    std::string mode;              ///< Graph mode, "materialized" or "implicit"
+    int length = 0;                ///< Word length
+    size_t requestedWords = 0;     ///< Words asked of the generator
+    size_t words = 0;              ///< Words kept by the loader
+    size_t edges = 0;              ///< Edges in the graph
+    size_t fileBytes = 0;          ///< Size of the dictionary file
+    double loadMs = 0.0;           ///< Best loadDictionary time
+    double buildMs = 0.0;          ///< Best buildGraph time (hashing the words in implicit mode)
+    size_t gameBytes = 0;          ///< WordLadderGame::memoryUsage after the build
+    size_t peakRssBytes = 0;       ///< Peak resident set size of the process after this case
+    std::vector<SearchResult> searches; ///< One entry per strategy
+};
+
+/**
+ * @brief Writes a synthetic dictionary of random words
+ * @param path The file to write
+ * @param wordCount The number of distinct words to generate
+ * @param length The length of every word
+ * @param alphabet The number of letters to draw from, the most frequent first
+ * @param seed Seed of the random generator, so runs are repeatable
+ * @return true if the file was written
+ */
+bool writeSyntheticDictionary(const std::string& path, size_t wordCount, int length, int alphabet, unsigned seed) {
+    // Keep the most frequent letters of the alphabet, in alphabetical order
+    std::vector<int> order(26);
+    for (int i = 0; i < 26; ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [](int a, int b) { return letterWeights[a] > letterWeights[b]; });
+    order.resize(static_cast<size_t>(alphabet));
+    std::sort(order.begin(), order.end());
+    std::vector<double> weights;
+    for (int letter : order) {
+        weights.push_back(letterWeights[letter]);
+    }
+
+    std::mt19937 engine(seed);
+    std::discrete_distribution<int> letters(weights.begin(), weights.end());
+    std::vector<std::string> words;
+    words.reserve(wordCount + wordCount / 4);
+    std::string word(static_cast<size_t>(length), 'a');
+    // Draw extra words to make up for duplicates, which the loader removes
+    for (size_t i = 0; i < wordCount + wordCount / 4; ++i) {
+        for (char& c : word) {
+            c = static_cast<char>('a' + order[static_cast<size_t>(letters(engine))]);
+        }
+        words.push_back(word);
+    }
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+    std::shuffle(words.begin(), words.end(), engine);
+    words.resize(std::min(words.size(), wordCount));
+
+    std::ofstream out(path, std::ios::trunc);
+    for (const std::string& w : words) {
+        out << w << '\n';
+    }
+    return out.good();
+}
+
+/**
+ * @brief Gets the path of a synthetic dictionary in the temporary directory
+ * @param length The word length
+ * @param wordCount The requested number of words
+ * @return The file path
+ */
+std::string syntheticPath(int length, size_t wordCount) {
+    return (std::filesystem::temp_directory_path()
+        / ("wordladder_synthetic_" + std::to_string(length) + "_" + std::to_string(wordCount) + ".txt")).string();
+}
+
+/**
+ * @brief Resets the peak resident set size of the process, where supported
+ *
+ * On Linux, writing 5 to /proc/self/clear_refs resets the high-water mark,
+ * so the peak measured after a case belongs to that case alone.
+ */
+void resetPeakMemory() {
+#ifdef __linux__
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+#endif
+}
+
+/**
+ * @brief Gets the peak resident set size of the process
+ * @return The peak in bytes, or 0 where it cannot be measured
+ */
+size_t peakMemory() {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return static_cast<size_t>(std::strtoull(line.c_str() + 6, nullptr, 10)) * 1024;
+        }
+    }
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return static_cast<size_t>(usage.ru_maxrss) * 1024;
+    }
+#endif
+    return 0;
+}
+
+/**
+ * @brief Gets a percentile of sorted samples
+ * @param sorted Samples in ascending order, not empty
+ * @param fraction The percentile as a fraction, 0 to 1
+ * @return The sample at that rank
+ */
+double percentile(const std::vector<double>& sorted, double fraction) {
+    const size_t rank = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+/**
+ * @brief Picks random pairs of connected words
+ * @param game The game to pick from
+ * @param count The number of pairs wanted
+ * @param seed Seed of the random generator
+ * @return Up to count pairs; fewer if connected pairs are too rare to find
+ */
+std::vector<std::pair<std::string, std::string>> pickQueries(const WordLadderGame& game, size_t count, unsigned seed) {
+    std::vector<std::pair<std::string, std::string>> pairs;
+    const std::vector<std::string_view>& words = game.getDictionary();
+    if (words.size() < 2) {
+        return pairs;
+    }
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<size_t> pick(0, words.size() - 1);
+    for (size_t attempt = 0; attempt < count * 1000 && pairs.size() < count; ++attempt) {
+        const std::string start(words[pick(engine)]);
+        const std::string target(words[pick(engine)]);
+        if (start != target && game.areConnected(start, target)) {
+            pairs.emplace_back(start, target);
+        }
+    }
+    return pairs;
+}
+
+/**
+ * @brief Times one search strategy over a query set
+ * @param game The game to search; its strategy is changed
+ * @param strategy The strategy to time
+ * @param name The strategy name for the report
+ * @param queries The start/target pairs
+ * @return The timings
+ */
+SearchResult timeSearches(WordLadderGame& game, WordLadderGame::SearchStrategy strategy, const std::string& name,
+                          const std::vector<std::pair<std::string, std::string>>& queries) {
+    SearchResult result;
+    result.strategy = name;
+    game.setSearchStrategy(strategy); // Landmark tables are built here, outside the timed queries
+    if (queries.empty()) {
+        return result;
+    }
+
+    SearchContext context;
+    std::vector<double> micros;
+    micros.reserve(queries.size());
+    size_t expanded = 0;
+    for (const auto& query : queries) {
+        game.findShortestPath(query.first, query.second, context); // Warm the buffers
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& query : queries) {
+        game.findShortestPath(query.first, query.second, context);
+        micros.push_back(context.stats.elapsedMicros);
+        expanded += context.stats.nodesExpanded;
+    }
+    const double totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::sort(micros.begin(), micros.end());
+    double sum = 0.0;
+    for (double m : micros) {
+        sum += m;
+    }
+    result.meanMicros = sum / micros.size();
+    result.p50Micros = percentile(micros, 0.50);
+    result.p95Micros = percentile(micros, 0.95);
+    result.meanExpanded = static_cast<double>(expanded) / queries.size();
+    result.queriesPerSecond = totalMs > 0.0 ? queries.size() * 1000.0 / totalMs : 0.0;
+    return result;
+}
+
+/**
+ * @brief Gets the name of a graph mode for the report
+ * @param mode The graph mode
+ * @return "materialized" or "implicit"
+ */
+std::string modeName(WordLadderGame::GraphMode mode) {
+    return mode == WordLadderGame::GraphMode::Implicit ? "implicit" : "materialized";
+}
+
+/**
+ * @brief Measures one synthetic dictionary in one graph mode
+ * @param options The run settings
+ * @param path The generated dictionary
+ * @param length The word length
+ * @param wordCount The requested number of words
+ * @param mode The graph mode to build
+ * @param result Receives the measurements
+ * @return true if the dictionary could be loaded
+ */
+bool runCase(const Options& options, const std::string& path, int length, size_t wordCount,
+             WordLadderGame::GraphMode mode, CaseResult& result) {
+    resetPeakMemory();
+
+    result.mode = modeName(mode);
+    result.length = length;
+    result.requestedWords = wordCount;
+    std::error_code error;
+    result.fileBytes = static_cast<size_t>(std::filesystem::file_size(path, error));
+
+    WordLadderGame game;
+    game.setThreadCount(options.threads);
+    game.setGraphMode(mode);
+    for (int run = 0; run < options.runs; ++run) {
+        if (!game.loadDictionary(path, length)) {
+            std::cerr << "Could not load " << path << "\n";
+            return false;
+        }
+        if (run == 0 || game.getLastLoadTimeMs() < result.loadMs) {
+            result.loadMs = game.getLastLoadTimeMs();
+        }
+    }
+    for (int run = 0; run < options.runs; ++run) {
+        game.buildGraph();
+        if (run == 0 || game.getLastBuildTimeMs() < result.buildMs) {
+            result.buildMs = game.getLastBuildTimeMs();
+        }
+    }
+    result.words = game.getDictionary().size();
+    result.edges = game.getEdgeCount();
+
+    const auto queries = pickQueries(game, options.queries, options.seed);
+    result.searches.push_back(timeSearches(game, WordLadderGame::SearchStrategy::BreadthFirst, "bfs", queries));
+    result.searches.push_back(timeSearches(game, WordLadderGame::SearchStrategy::Bidirectional, "bidirectional", queries));
+    result.searches.push_back(timeSearches(game, WordLadderGame::SearchStrategy::LandmarkAStar, "astar", queries));
+
+    result.gameBytes = game.memoryUsage();
+    result.peakRssBytes = peakMemory();
+    return true;
+}
+
+/**
+ * @brief Escapes a string for a JSON string literal
+ * @param text The text to escape
+ * @return The escaped text, without quotes
+ */
+std::string jsonEscape(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+            escaped += buffer;
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+/**
+ * @brief Writes the suite results as JSON
+ * @param out The stream to write
+ * @param options The run settings
+ * @param results The measurements of every case
+ *
+ * The document carries its own schema version so that comparison scripts
+ * can reject files they do not understand.
+ */
+void writeJson(std::ostream& out, const Options& options, const std::vector<CaseResult>& results) {
+    const std::time_t now = std::time(nullptr);
+    char timestamp[32];
+    std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\n"
+        << "  \"schema\": 2,\n"
+        << "  \"label\": \"" << jsonEscape(options.label) << "\",\n"
+        << "  \"timestamp\": \"" << timestamp << "\",\n"
+        << "  \"hardwareThreads\": " << std::thread::hardware_concurrency() << ",\n"
+        << "  \"buildThreads\": " << options.threads << ",\n"
+        << "  \"alphabet\": " << options.alphabet << ",\n"
+        << "  \"seed\": " << options.seed << ",\n"
+        << "  \"runs\": " << options.runs << ",\n"
+        << "  \"cases\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const CaseResult& r = results[i];
+        out << (i == 0 ? "\n" : ",\n")
+            << "    {\n"
+            << "      \"mode\": \"" << r.mode << "\",\n"
+            << "      \"length\": " << r.length << ",\n"
+            << "      \"requestedWords\": " << r.requestedWords << ",\n"
+            << "      \"words\": " << r.words << ",\n"
+            << "      \"edges\": " << r.edges << ",\n"
+            << "      \"fileBytes\": " << r.fileBytes << ",\n"
+            << "      \"loadMs\": " << r.loadMs << ",\n"
+            << "      \"buildMs\": " << r.buildMs << ",\n"
+            << "      \"gameBytes\": " << r.gameBytes << ",\n"
+            << "      \"peakRssBytes\": " << r.peakRssBytes << ",\n"
+            << "      \"searches\": [";
+        for (size_t j = 0; j < r.searches.size(); ++j) {
+            const SearchResult& s = r.searches[j];
+            out << (j == 0 ? "\n" : ",\n")
+                << "        {\"strategy\": \"" << s.strategy << "\""
+                << ", \"meanMicros\": " << s.meanMicros
+                << ", \"p50Micros\": " << s.p50Micros
+                << ", \"p95Micros\": " << s.p95Micros
+                << ", \"meanExpanded\": " << s.meanExpanded
+                << ", \"queriesPerSecond\": " << s.queriesPerSecond << "}";
+        }
+        out << "\n      ]\n"
+            << "    }";
+    }
+    out << "\n  ]\n"
+        << "}\n";
+}
+
+/**
+ * @brief Runs every case of the suite and reports the results
+ * @param options The run settings
+ * @return The process exit code
+ *
+ * Each dictionary is generated once and measured in every selected graph
+ * mode, so the modes are compared on the same words and queries. Prints a
+ * table as the cases complete and writes the JSON document at the end.
+ */
+int runSuite(const Options& options) {
+    std::vector<CaseResult> results;
+    // The table moves to standard error when the JSON goes to standard output
+    std::ostream& report = options.jsonPath == "-" ? std::cerr : std::cout;
+    report << std::setw(13) << "mode" << std::setw(4) << "len" << std::setw(9) << "words" << std::setw(10) << "edges"
+              << std::setw(10) << "load ms" << std::setw(10) << "build ms" << std::setw(10) << "game MiB"
+              << std::setw(10) << "peak MiB" << "  search mean us (nodes expanded)\n";
+    for (int length : options.lengths) {
+        for (size_t wordCount : options.wordCounts) {
+            const std::string path = syntheticPath(length, wordCount);
+            if (!writeSyntheticDictionary(path, wordCount, length, options.alphabet, options.seed)) {
+                std::cerr << "Could not write " << path << "\n";
+                return 1;
+            }
+            for (WordLadderGame::GraphMode mode : options.modes) {
+                CaseResult result;
+                if (!runCase(options, path, length, wordCount, mode, result)) {
+                    std::error_code error;
+                    std::filesystem::remove(path, error);
+                    return 1;
+                }
+                report << std::fixed << std::setw(13) << result.mode << std::setw(4) << result.length << std::setw(9) << result.words
+                          << std::setw(10) << result.edges
+                          << std::setprecision(1) << std::setw(10) << result.loadMs << std::setw(10) << result.buildMs
+                          << std::setw(10) << result.gameBytes / 1048576.0 << std::setw(10) << result.peakRssBytes / 1048576.0
+                          << " ";
+                for (const SearchResult& s : result.searches) {
+                    report << " " << s.strategy << " " << std::setprecision(1) << s.meanMicros
+                              << " (" << std::setprecision(0) << s.meanExpanded << ")";
+                }
+                report << "\n";
+                results.push_back(std::move(result));
+            }
+            std::error_code error;
+            std::filesystem::remove(path, error);
+        }
+    }
+
+    if (options.jsonPath == "-") {
+        writeJson(std::cout, options, results);
+    } else if (!options.jsonPath.empty()) {
+        std::ofstream out(options.jsonPath, std::ios::trunc);
+        writeJson(out, options, results);
+        if (!out.good()) {
+            std::cerr << "Could not write " << options.jsonPath << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Builds the graph of one synthetic dictionary with 1 to maxThreads threads
+ * @param options The run settings; the first length and word count are used
+ * @return The process exit code
+ *
+ * Keeps the best of several runs per thread count, and checks that the
+ * edge count is the same for every thread count.
+ */
+int runScaling(const Options& options) {
+    const int length = options.lengths.front();
+    const size_t wordCount = options.wordCounts.front();
+    const std::string path = syntheticPath(length, wordCount);
+    if (!writeSyntheticDictionary(path, wordCount, length, options.alphabet, options.seed)) {
+        std::cerr << "Could not write " << path << "\n";
+        return 1;
+    }
+
+    WordLadderGame game;
+    if (!game.loadDictionary(path, length)) {
+        std::cerr << "Could not load " << path << "\n";
+        return 1;
+    }
+    std::cout << "Dictionary: " << game.getDictionary().size() << " words of length " << length
+              << " (loaded in " << std::fixed << std::setprecision(1) << game.getLastLoadTimeMs() << " ms)\n"
+              << "Hardware threads: " << std::thread::hardware_concurrency() << "\n\n"
+              << std::setw(8) << "threads" << std::setw(12) << "build ms" << std::setw(10) << "speedup"
+              << std::setw(12) << "efficiency" << std::setw(12) << "edges" << "\n";
+
+    double baseline = 0.0;
+    size_t expectedEdges = 0;
+    bool consistent = true;
+    for (unsigned threads = 1; threads <= options.maxThreads; ++threads) {
+        game.setThreadCount(threads);
+        double best = 0.0;
+        for (int run = 0; run < options.runs; ++run) {
+            game.buildGraph();
+            if (run == 0 || game.getLastBuildTimeMs() < best) {
+                best = game.getLastBuildTimeMs();
+            }
+        }
+        if (threads == 1) {
+            baseline = best;
+            expectedEdges = game.getEdgeCount();
+        } else if (game.getEdgeCount() != expectedEdges) {
+            consistent = false;
+        }
+        std::cout << std::setw(8) << threads
+                  << std::setw(12) << std::setprecision(1) << best
+                  << std::setw(9) << std::setprecision(2) << baseline / best << "x"
+                  << std::setw(11) << std::setprecision(0) << 100.0 * baseline / best / threads << "%"
+                  << std::setw(12) << game.getEdgeCount() << "\n";
+    }
+
+    std::error_code error;
+    std::filesystem::remove(path, error);
+    if (!consistent) {
+        std::cerr << "Edge counts differ between thread counts.\n";
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Parses a comma-separated list of numbers
+ * @param text The list, e.g. "4,6,8"
+ * @param values Receives the numbers
+ * @return true if the list is not empty and every entry is positive
+ */
+template <typename T>
+bool parseList(const char* text, std::vector<T>& values) {
+    values.clear();
+    std::istringstream in(text);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        const long long value = std::atoll(item.c_str());
+        if (value <= 0) {
+            return false;
+        }
+        values.push_back(static_cast<T>(value));
+    }
+    return !values.empty();
+}
+
+/**
+ * @brief Prints the command line options
+ */
+void printUsage() {
+    std::cout << "Usage: WordLadderBench [options]\n"
+                 "Generates synthetic dictionaries and times loading, graph building and\n"
+                 "searching (BFS, bidirectional BFS, landmark A*) on each.\n\n"
+                 "  --words N[,N...]     dictionary sizes (default 10000,100000)\n"
+                 "  --length L[,L...]    word lengths (default 4,6,8)\n"
+                 "  --alphabet K         letters used, most frequent first; fewer is denser (default 26)\n"
+                 "  --graph-mode M       materialized, implicit or both (default both)\n"
+                 "  --queries Q          searches timed per strategy (default 200)\n"
+                 "  --threads T          build threads, 0 for all (default 0)\n"
+                 "  --runs R             repetitions per measurement, best kept (default 3)\n"
+                 "  --seed S             generator seed (default 12345)\n"
+                 "  --json FILE          write results as JSON, '-' for standard output\n"
+                 "  --label TEXT         label stored in the JSON results\n"
+                 "  --scaling            instead, build the first case with 1 to --max-threads threads\n"
+                 "  --max-threads T      upper thread count of --scaling (default: all)\n";
+}
+
+} // namespace
+
+/**
+ * @brief Runs the benchmark suite or the build scaling report
+ *
+ * Every measurement runs on generated data in the temporary directory, so
+ * the benchmark needs no dictionary files and no display.
+ */
+int main(int argc, char *argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        bool valid = true;
+        if (std::strcmp(argv[i], "--words") == 0 && hasValue) {
+            valid = parseList(argv[++i], options.wordCounts);
+        } else if (std::strcmp(argv[i], "--length") == 0 && hasValue) {
+            valid = parseList(argv[++i], options.lengths);
+        } else if (std::strcmp(argv[i], "--alphabet") == 0 && hasValue) {
+            options.alphabet = std::atoi(argv[++i]);
+            valid = options.alphabet >= 2 && options.alphabet <= 26;
+        } else if (std::strcmp(argv[i], "--graph-mode") == 0 && hasValue) {
+            const std::string mode = argv[++i];
+            options.modes.clear();
+            if (mode == "materialized" || mode == "both") {
+                options.modes.push_back(WordLadderGame::GraphMode::Materialized);
+            }
+            if (mode == "implicit" || mode == "both") {
+                options.modes.push_back(WordLadderGame::GraphMode::Implicit);
+            }
+            valid = !options.modes.empty();
+        } else if (std::strcmp(argv[i], "--queries") == 0 && hasValue) {
+            options.queries = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            options.threads = static_cast<unsigned>(std::max(0, std::atoi(argv[++i])));
+        } else if (std::strcmp(argv[i], "--max-threads") == 0 && hasValue) {
+            options.maxThreads = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        } else if (std::strcmp(argv[i], "--runs") == 0 && hasValue) {
+            options.runs = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--seed") == 0 && hasValue) {
+            options.seed = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--json") == 0 && hasValue) {
+            options.jsonPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--label") == 0 && hasValue) {
+            options.label = argv[++i];
+        } else if (std::strcmp(argv[i], "--scaling") == 0) {
+            options.scaling = true;
+        } else {
+            printUsage();
+            return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+        if (!valid) {
+            printUsage();
+            return 1;
+        }
+    }
+    for (int length : options.lengths) {
+        if (length > static_cast<int>(PackedWord::maxLength)) {
+            std::cerr << "Word lengths must be 1 to " << PackedWord::maxLength << ".\n";
+            return 1;
+        }
+    }
+
+    return options.scaling ? runScaling(options) : runSuite(options);
+}
@@ -0,0 +1,273 @@
+#include "wordladdergame.h"
+#include "searchcontext.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+
+namespace {
+
+/**
+ * @struct Query
+ * @brief One start/target pair read from the input
+ */
+struct Query {
+    std::string start;  ///< The starting word, lowercased
+    std::string target; ///< The target word, lowercased
+};
+
+/**
+ * @brief Prints the command line options
+ */
+void printUsage() {
+    std::cerr << "Usage: WordLadderCli <dictionary> [queries|-] [--threads N] [--distance|--count]\n"
+                 "                     [--strategy bfs|bidirectional|astar] [--implicit] [--length L]\n"
+                 "       WordLadderCli <dictionary> --stats [--distances FILE] [--threads N] [--implicit]\n"
+                 "                     [--length L]\n"
+                 "Reads one 'start target' pair per line from the queries file, or from\n"
+                 "standard input if it is '-' or omitted, and prints one answer per line\n"
+                 "in input order: the ladder as space-separated words, or '-' if there is\n"
+                 "none. With --distance, the number of moves is printed instead, or -1.\n"
+                 "With --count, the number of moves is followed by the number of\n"
+                 "different shortest ladders, prefixed with '>=' if it overflowed.\n"
+                 "With --implicit, no adjacency lists are stored and neighbors are\n"
+                 "generated during the search instead, which saves memory on dense\n"
+                 "dictionaries. Throughput is reported on standard error.\n"
+                 "With --length, only words of L letters are read from the dictionary;\n"
+                 "otherwise the most common length is used.\n"
+                 "With --stats, no queries are read; the diameter, radius, average ladder\n"
+                 "length and the histograms of ladder lengths and eccentricities are\n"
+                 "printed instead. --distances also saves the distance of every pair of\n"
+                 "words to a binary file, for dictionaries of up to 20000 words.\n";
+}
+
+constexpr size_t maxDistanceWords = 20000; ///< Largest dictionary whose distance matrix is saved (400 MB)
+
+/**
+ * @brief Lowercases a word in place
+ * @param word The word to lowercase
+ */
+void toLower(std::string& word) {
+    std::transform(word.begin(), word.end(), word.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+}
+
+/**
+ * @brief Reads all queries from a stream
+ * @param in The stream to read
+ * @param queries Receives the queries in input order
+ *
+ * Blank lines are skipped. A line with fewer than two words becomes a query
+ * with an empty target, which has no ladder.
+ */
+void readQueries(std::istream& in, std::vector<Query>& queries) {
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        Query query;
+        if (!(fields >> query.start)) {
+            continue;
+        }
+        fields >> query.target;
+        toLower(query.start);
+        toLower(query.target);
+        queries.push_back(std::move(query));
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Answers batches of word ladder queries from the command line
+ *
+ * Loads the dictionary and its graph (through the graph cache), reads every
+ * query, then answers them on several threads at once. The game is shared
+ * read-only; each thread owns a SearchContext and claims queries in small
+ * blocks from an atomic counter. Answers are stored by query index and
+ * printed in input order once all threads have finished.
+ */
+int main(int argc, char *argv[]) {
+    std::string dictionaryPath;
+    std::string queryPath = "-";
+    unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+    bool distanceOnly = false;
+    bool countLadders = false;
+    bool statistics = false;
+    std::string distancesPath;
+    WordLadderGame::SearchStrategy strategy = WordLadderGame::SearchStrategy::Bidirectional;
+    WordLadderGame::GraphMode graphMode = WordLadderGame::GraphMode::Materialized;
+    int wordLength = 0;
+
+    int positional = 0;
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            threadCount = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        } else if (std::strcmp(argv[i], "--distance") == 0) {
+            distanceOnly = true;
+        } else if (std::strcmp(argv[i], "--count") == 0) {
+            countLadders = true;
+        } else if (std::strcmp(argv[i], "--stats") == 0) {
+            statistics = true;
+        } else if (std::strcmp(argv[i], "--distances") == 0 && hasValue) {
+            distancesPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--length") == 0 && hasValue) {
+            wordLength = std::atoi(argv[++i]);
+            if (wordLength < 1 || wordLength > static_cast<int>(PackedWord::maxLength)) {
+                printUsage();
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--implicit") == 0) {
+            graphMode = WordLadderGame::GraphMode::Implicit;
+        } else if (std::strcmp(argv[i], "--strategy") == 0 && hasValue) {
+            const std::string name = argv[++i];
+            if (name == "bfs") {
+                strategy = WordLadderGame::SearchStrategy::BreadthFirst;
+            } else if (name == "bidirectional") {
+                strategy = WordLadderGame::SearchStrategy::Bidirectional;
+            } else if (name == "astar") {
+                strategy = WordLadderGame::SearchStrategy::LandmarkAStar;
+            } else {
+                printUsage();
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--help") == 0) {
+            printUsage();
+            return 0;
+        } else if (argv[i][0] != '-' || std::strcmp(argv[i], "-") == 0) {
+            if (positional == 0) {
+                dictionaryPath = argv[i];
+            } else if (positional == 1) {
+                queryPath = argv[i];
+            } else {
+                printUsage();
+                return 1;
+            }
+            ++positional;
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+    if (dictionaryPath.empty() || (!distancesPath.empty() && !statistics)) {
+        printUsage();
+        return 1;
+    }
+
+    WordLadderGame game;
+    game.setSearchStrategy(strategy);
+    game.setGraphMode(graphMode);
+    if (!game.loadDictionaryWithCache(dictionaryPath, wordLength)) {
+        std::cerr << "Could not load dictionary: " << dictionaryPath << "\n";
+        return 1;
+    }
+
+    if (statistics) {
+        const bool keepDistances = !distancesPath.empty();
+        if (keepDistances && game.getDictionary().size() > maxDistanceWords) {
+            std::cerr << "Too many words for a distance matrix: " << game.getDictionary().size()
+                      << " (at most " << maxDistanceWords << ")\n";
+            return 1;
+        }
+        game.setThreadCount(threadCount);
+        auto start = std::chrono::steady_clock::now();
+        const GraphStatistics stats = game.computeStatistics(keepDistances);
+        const double elapsedMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        stats.writeReport(std::cout);
+        std::cout << std::flush;
+        if (keepDistances && !stats.writeDistances(distancesPath)) {
+            std::cerr << "Could not write distances: " << distancesPath << "\n";
+            return 1;
+        }
+        std::cerr << "Measured " << stats.wordCount() << " words in " << std::fixed << std::setprecision(1)
+                  << elapsedMs << " ms on " << threadCount << " threads\n";
+        return 0;
+    }
+
+    std::vector<Query> queries;
+    if (queryPath == "-") {
+        readQueries(std::cin, queries);
+    } else {
+        std::ifstream in(queryPath);
+        if (!in.is_open()) {
+            std::cerr << "Could not open queries: " << queryPath << "\n";
+            return 1;
+        }
+        readQueries(in, queries);
+    }
+
+    // Each thread writes only the answers of the queries it claimed
+    std::vector<std::string> answers(queries.size());
+    std::atomic<size_t> nextQuery(0);
+    constexpr size_t blockSize = 64; // Queries claimed at once, to keep the counter cold
+    auto work = [&]() {
+        SearchContext context;
+        for (;;) {
+            const size_t first = nextQuery.fetch_add(blockSize, std::memory_order_relaxed);
+            if (first >= queries.size()) {
+                break;
+            }
+            const size_t last = std::min(first + blockSize, queries.size());
+            for (size_t i = first; i < last; ++i) {
+                if (countLadders) {
+                    const LadderDag dag = game.findAllShortestPaths(queries[i].start, queries[i].target, context);
+                    answers[i] = std::to_string(dag.length()) + (dag.isCountSaturated() ? " >=" : " ")
+                               + std::to_string(dag.pathCount());
+                    continue;
+                }
+                const std::vector<std::string> path =
+                    game.findShortestPath(queries[i].start, queries[i].target, context);
+                if (distanceOnly) {
+                    answers[i] = std::to_string(static_cast<long long>(path.size()) - 1);
+                } else if (path.empty()) {
+                    answers[i] = "-";
+                } else {
+                    std::string& ladder = answers[i];
+                    for (const std::string& word : path) {
+                        if (!ladder.empty()) {
+                            ladder += ' ';
+                        }
+                        ladder += word;
+                    }
+                }
+            }
+        }
+    };
+
+    const unsigned threads = static_cast<unsigned>(
+        std::max<size_t>(1, std::min<size_t>(threadCount, (queries.size() + blockSize - 1) / blockSize)));
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    const double elapsedMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::ostringstream out;
+    for (const std::string& answer : answers) {
+        out << answer << '\n';
+    }
+    std::cout << out.str() << std::flush;
+
+    std::cerr << "Answered " << queries.size() << " queries in " << std::fixed << std::setprecision(1)
+              << elapsedMs << " ms on " << threads << " threads ("
+              << std::setprecision(0) << (elapsedMs > 0.0 ? queries.size() * 1000.0 / elapsedMs : 0.0)
+              << " queries/s)\n";
+    return 0;
+}
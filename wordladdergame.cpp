@@ -1,128 +1,1947 @@
 #include "wordladdergame.h"
+#include "mappedfile.h"
+#include "packedword.h"
+#include "graphcache.h"
 #include <iostream>
 #include <fstream>
 #include <algorithm>
+#include <cctype>
+#include <cstring>
 #include <random>
 #include <chrono>
+#include <utility>
+#include <thread>
+#include <filesystem>
+#include <unordered_map>
+#include <type_traits>
+
+namespace {
+
+/**
+ * @brief Calls a function once per letter position, unrolled at compile time
+ * @param f Called with a std::integral_constant holding each position in turn
+ */
+template <typename F, size_t... Positions>
+inline void forEachPosition(F&& f, std::index_sequence<Positions...>) {
+    (f(std::integral_constant<size_t, Positions>()), ...);
+}
+
+} // namespace
+
+/**
+ * @brief Constructs a new Word Ladder Game instance
+ * 
+ * Initializes the random number generator with a time-based seed.
+ */
+WordLadderGame::WordLadderGame()
+    : graphMode(GraphMode::Materialized)
+    , implicitGraph(false)
+    , currentWordLength(0)
+    , sortedWordCount(0)
+    , dictionaryStale(false)
+    , packedLaneBits(0)
+    , neighborCollector(neighborCollectorFor(0))
+    , lastLoadTimeMs(0.0)
+    , lastBuildTimeMs(0.0)
+    , loadedFromCache(false)
+    , cancelFlag(nullptr)
+    , cancelled(false)
+    , threadCount(0)
+    , searchStrategy(SearchStrategy::Bidirectional)
+    , pairableWordCount(0)
+    , componentsStale(false)
+    , membersStale(false)
+    , landmarksStale(false)
+    , probeCursor(0)
+    , longestLadder(-1)
+    , ladderBound(0) {
+    // Initialize random number generator with time-based seed
+    unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
+    randomEngine.seed(seed);
+}
+
+/**
+ * @brief Loads a dictionary from a file
+ * @param filename The path to the dictionary file
+ * @param wordLength The length of the words to keep, or 0 for the most common length
+ * @return true if dictionary was loaded successfully, false otherwise
+ * 
+ * Maps the file read-only and scans it for line breaks in bulk. Each line is
+ * trimmed (which also drops the '\r' of Windows line endings), lowercased and
+ * packed straight into a fixed-width key, so the keys form one contiguous
+ * word arena. Lines of another length than the requested one, longer than a
+ * key can hold, or with characters other than letters are skipped, so a
+ * stray header or a misspelt first line does not decide what is kept.
+ * Without a requested length the keys are collected per length in the same
+ * pass and the length with the most words wins. Sorting and deduplicating
+ * the keys is then plain integer work, and the word list is unpacked from
+ * them once. Progress is reported and the cancel flag polled every few ten
+ * thousand lines.
+ */
+bool WordLadderGame::loadDictionary(const std::string& filename, int wordLength) {
+    auto loadStart = std::chrono::steady_clock::now();
+    cancelled = false;
+    LoadCounters& counters = instrumentation.load;
+    counters = LoadCounters();
+    MappedFile file;
+    if (!file.open(filename)) {
+        return false;
+    }
+    WL_INSTRUMENT(counters.bytesRead = file.size());
+
+    clearWords();
+    implicitGraph = false;
+    if (wordLength < 0 || wordLength > static_cast<int>(PackedWord::maxLength)) {
+        return false;
+    }
+    char lowered[PackedWord::maxLength];
+    // Keys of each length while the length is still open; only one is used otherwise
+    std::vector<PackedWord::Key> keysByLength[PackedWord::maxLength + 1];
+    size_t wordsRead = 0;
+
+    const char* cursor = file.data();
+    const char* const end = cursor + file.size();
+    size_t lineCount = 0;
+    while (cursor < end) {
+        if ((++lineCount & 0xFFFF) == 0) {
+            if (cancelRequested()) {
+                return false;
+            }
+            reportProgress(wordsRead, 0,
+                           static_cast<int>(30 * static_cast<double>(cursor - file.data()) / file.size()));
+        }
+        const char* lineEnd = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+        if (lineEnd == nullptr) {
+            lineEnd = end;
+        }
+        const char* first = cursor;
+        const char* last = lineEnd;
+        cursor = lineEnd + 1;
+
+        // Trim surrounding whitespace, including the CR of CRLF endings
+        while (first < last && std::isspace(static_cast<unsigned char>(*first))) {
+            ++first;
+        }
+        while (last > first && std::isspace(static_cast<unsigned char>(last[-1]))) {
+            --last;
+        }
+        const size_t length = static_cast<size_t>(last - first);
+        if (length == 0) {
+            continue;
+        }
+        WL_INSTRUMENT(++counters.linesRead);
+        if ((wordLength != 0 && length != static_cast<size_t>(wordLength)) || length > PackedWord::maxLength) {
+            WL_INSTRUMENT(++counters.wordsRejected);
+            continue;
+        }
+
+        // ASCII lowercase for letters; anything else is rejected by pack
+        for (size_t i = 0; i < length; ++i) {
+            lowered[i] = static_cast<char>(first[i] | 0x20);
+        }
+        PackedWord::Key key;
+        if (PackedWord::pack(lowered, length, key)) {
+            std::vector<PackedWord::Key>& keys = keysByLength[length];
+            WL_INSTRUMENT(counters.estimatedAllocations += keys.size() == keys.capacity() ? 1 : 0);
+            keys.push_back(key);
+            ++wordsRead;
+        } else {
+            WL_INSTRUMENT(++counters.wordsRejected);
+        }
+    }
+
+    if (wordLength == 0) {
+        // Most words wins; ties go to the shorter length
+        for (size_t length = 1; length <= PackedWord::maxLength; ++length) {
+            if (keysByLength[length].size() > keysByLength[static_cast<size_t>(wordLength)].size()) {
+                wordLength = static_cast<int>(length);
+            }
+        }
+        WL_INSTRUMENT(counters.wordsRejected += wordsRead - keysByLength[static_cast<size_t>(wordLength)].size());
+    }
+    currentWordLength = wordLength;
+    packedWords.swap(keysByLength[static_cast<size_t>(wordLength)]);
+
+    // Sort and remove duplicates; key order is alphabetical order
+    std::sort(packedWords.begin(), packedWords.end());
+    WL_INSTRUMENT(const size_t packedCount = packedWords.size());
+    packedWords.erase(std::unique(packedWords.begin(), packedWords.end()), packedWords.end());
+    WL_INSTRUMENT(counters.duplicates = packedCount - packedWords.size());
+    WL_INSTRUMENT(counters.estimatedAllocations += packedWords.size() < packedWords.capacity() ? 1 : 0);
+    packedWords.shrink_to_fit();
+    sortedWordCount = packedWords.size();
+    removedWords.assign(packedWords.size(), false);
+    wordTable.build(packedWords);
+
+    packedLaneBits = PackedWord::laneLowBits(static_cast<size_t>(currentWordLength));
+    neighborCollector = neighborCollectorFor(static_cast<size_t>(currentWordLength));
+    wordText.assign(packedWords, static_cast<size_t>(currentWordLength));
+    dictionaryStale = true;
+
+    lastLoadTimeMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - loadStart).count();
+    counters.wallMs = lastLoadTimeMs;
+    WL_INSTRUMENT(counters.wordsKept = packedWords.size());
+    WL_INSTRUMENT(counters.estimatedAllocations += 3); // The word arena and the two table arrays
+    reportProgress(packedWords.size(), 0, 30);
+    return true;
+}
+
+/**
+ * @brief Builds the word graph from the loaded dictionary
+ * 
+ * Creates edges between words that differ by exactly one letter.
+ * Instead of comparing every pair of words, each word is filed under
+ * one wildcard pattern per letter position ("c*t", "ca*", ...), which for
+ * packed words is the key with one lane cleared. Two words are one letter
+ * apart exactly when they share a pattern, so every bucket is a clique of
+ * neighbors and edge discovery is close to linear in the dictionary size.
+ * 
+ * The buckets of one position are split further by a letter outside the
+ * masked lane (the first letter, or the second when the first is masked),
+ * since words sharing a bucket share that letter too. Each (position,
+ * letter) pair is an independent work item; worker threads claim items from
+ * an atomic counter and collect edges in buffers of their own, so nothing
+ * is locked while edges are found. The buffers are then copied side by side
+ * into one edge list, each thread writing its own slice, and frozen into a
+ * compact CSR graph whose node IDs are dictionary indices. Rows are sorted
+ * in dictionary order, so the graph does not depend on the thread count.
+ * Finally the indexes derived from the graph are rebuilt by finishGraph.
+ * Words added or removed by editWords since the last load are folded into
+ * the sorted word table first. Progress is reported and the cancel flag polled by the calling thread,
+ * which works on items alongside the others. An empty dictionary has no
+ * items and gets an empty graph straight away.
+ * 
+ * In implicit mode no edges are found at all: searches generate the
+ * 25 * length one-letter variants of each word they expand and keep those
+ * found in the word hash table filled by loadDictionary. The graph then holds its nodes only.
+ */
+void WordLadderGame::buildGraph() {
+    auto buildStart = std::chrono::steady_clock::now();
+    cancelled = false;
+    BuildCounters& counters = instrumentation.build;
+    counters = BuildCounters();
+    wordGraph.clear(); // Clears the graph before building a new one
+    implicitGraph = false;
+    normalizeWords();
+
+    if (graphMode == GraphMode::Implicit) {
+        wordGraph = WordGraph::fromEdgeList(packedWords, {});
+        implicitGraph = true;
+        finishGraph();
+        lastBuildTimeMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - buildStart).count();
+        counters.wallMs = lastBuildTimeMs;
+        WL_INSTRUMENT(counters.threads = 1);
+        WL_INSTRUMENT(counters.estimatedAllocations = 2); // The node table and the CSR offsets
+        reportProgress(packedWords.size(), 0, 100);
+        return;
+    }
+
+    using Edge = std::pair<WordGraph::NodeId, WordGraph::NodeId>;
+    const size_t length = static_cast<size_t>(currentWordLength);
+    const size_t wordCount = packedWords.size();
+    constexpr size_t letterCount = 26;
+    const size_t itemCount = length * letterCount;
+    if (itemCount == 0) {
+        // Nothing was loaded, so there are no items to split the work into
+        reportProgress(wordCount, 0, 95);
+        wordGraph = WordGraph::fromEdgeList(packedWords, {});
+        finishGraph();
+        lastBuildTimeMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - buildStart).count();
+        counters.wallMs = lastBuildTimeMs;
+        WL_INSTRUMENT(counters.threads = 1);
+        reportProgress(wordCount, 0, 100);
+        return;
+    }
+
+    // packedWords is sorted, so words sharing a first letter form one range
+    std::vector<size_t> firstLetterStart(letterCount + 1, wordCount);
+    if (length > 0) {
+        const int firstShift = PackedWord::laneShift(0, length);
+        for (size_t letter = 0; letter <= letterCount; ++letter) {
+            const PackedWord::Key bound = static_cast<PackedWord::Key>(letter + 1) << firstShift;
+            firstLetterStart[letter] = static_cast<size_t>(
+                std::lower_bound(packedWords.begin(), packedWords.end(), bound) - packedWords.begin());
+        }
+    }
+
+    const unsigned threads = static_cast<unsigned>(
+        std::max<size_t>(1, std::min<size_t>(getThreadCount(), itemCount)));
+    std::vector<std::vector<Edge>> threadEdges(threads);
+    std::atomic<size_t> nextItem(0);
+    std::atomic<size_t> itemsDone(0);
+    std::atomic<size_t> edgesFound(0);
+    std::atomic<bool> stop(false);
+    std::atomic<size_t> bufferAllocations(0);
+
+    // Finds the edges of every claimed work item. Runs on each worker; the
+    // calling thread (index 0) also polls cancellation and reports progress
+    // whenever the percentage moves, so a load reports a few dozen times.
+    auto work = [&](unsigned index) {
+        std::vector<Edge>& edges = threadEdges[index];
+        std::vector<std::pair<PackedWord::Key, WordGraph::NodeId>> masked;
+        int reportedPercent = -1;
+        WL_INSTRUMENT(size_t allocations = 0);
+        for (;;) {
+            if (index == 0) {
+                if (cancelRequested()) {
+                    stop.store(true, std::memory_order_relaxed);
+                }
+                const int percent = 30 + static_cast<int>(65 * itemsDone.load(std::memory_order_relaxed) / itemCount);
+                if (percent != reportedPercent) {
+                    reportedPercent = percent;
+                    reportProgress(wordCount, edgesFound.load(std::memory_order_relaxed), percent);
+                }
+            }
+            const size_t item = nextItem.fetch_add(1, std::memory_order_relaxed);
+            if (item >= itemCount || stop.load(std::memory_order_relaxed)) {
+                WL_INSTRUMENT(bufferAllocations.fetch_add(allocations, std::memory_order_relaxed));
+                break;
+            }
+            const size_t pos = item / letterCount;
+            const size_t letter = item % letterCount;
+            const PackedWord::Key clearLane = ~(PackedWord::letterMask << PackedWord::laneShift(pos, length));
+
+            WL_INSTRUMENT(const size_t maskedCapacity = masked.capacity());
+            WL_INSTRUMENT(const size_t edgeCapacity = edges.capacity());
+
+            // Gather the words of this item with their masked keys
+            masked.clear();
+            if (pos != 0) {
+                for (size_t i = firstLetterStart[letter]; i < firstLetterStart[letter + 1]; ++i) {
+                    masked.emplace_back(packedWords[i] & clearLane, static_cast<WordGraph::NodeId>(i));
+                }
+            } else if (length > 1) {
+                const int secondShift = PackedWord::laneShift(1, length);
+                for (size_t i = 0; i < wordCount; ++i) {
+                    if (((packedWords[i] >> secondShift) & PackedWord::letterMask) == letter + 1) {
+                        masked.emplace_back(packedWords[i] & clearLane, static_cast<WordGraph::NodeId>(i));
+                    }
+                }
+            } else if (letter == 0) {
+                // One-letter words: every word shares the single bucket
+                for (size_t i = 0; i < wordCount; ++i) {
+                    masked.emplace_back(0, static_cast<WordGraph::NodeId>(i));
+                }
+            }
+            std::sort(masked.begin(), masked.end());
+
+            // Runs of equal masked keys are the wildcard buckets, and every
+            // pair inside a run differs only at the masked position. Distinct
+            // words share at most one bucket, so no edge is found twice.
+            const size_t edgesBefore = edges.size();
+            for (size_t runStart = 0; runStart < masked.size(); ) {
+                size_t runEnd = runStart + 1;
+                while (runEnd < masked.size() && masked[runEnd].first == masked[runStart].first) {
+                    ++runEnd;
+                }
+                for (size_t a = runStart; a < runEnd; ++a) {
+                    for (size_t b = a + 1; b < runEnd; ++b) {
+                        edges.emplace_back(masked[a].second, masked[b].second);
+                    }
+                }
+                runStart = runEnd;
+            }
+            // Growth is counted once per item, which is exact while a buffer
+            // grows at most once per item and an undercount otherwise
+            WL_INSTRUMENT(allocations += (masked.capacity() != maskedCapacity) + (edges.capacity() != edgeCapacity));
+            edgesFound.fetch_add(edges.size() - edgesBefore, std::memory_order_relaxed);
+            itemsDone.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t) {
+        workers.emplace_back(work, t);
+    }
+    work(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    if (cancelled) {
+        // Unload the words too, so that no lookup finds a node the empty graph lacks
+        clearWords();
+        finishGraph();
+        return;
+    }
+
+    // Concatenate the thread buffers; each thread copies into its own slice
+    std::vector<size_t> sliceStart(threads + 1, 0);
+    for (unsigned t = 0; t < threads; ++t) {
+        sliceStart[t + 1] = sliceStart[t] + threadEdges[t].size();
+    }
+    std::vector<Edge> edges(sliceStart[threads]);
+    auto copySlice = [&](unsigned t) {
+        std::copy(threadEdges[t].begin(), threadEdges[t].end(), edges.begin() + sliceStart[t]);
+        std::vector<Edge>().swap(threadEdges[t]);
+    };
+    workers.clear();
+    for (unsigned t = 1; t < threads; ++t) {
+        workers.emplace_back(copySlice, t);
+    }
+    copySlice(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // Freeze into the compact form; node IDs are dictionary indices and
+    // neighbor slices come out sorted in dictionary order
+    wordGraph = WordGraph::fromEdgeList(packedWords, edges);
+    finishGraph();
+
+    lastBuildTimeMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - buildStart).count();
+    counters.wallMs = lastBuildTimeMs;
+    WL_INSTRUMENT(counters.threads = threads);
+    WL_INSTRUMENT(counters.workItems = itemsDone.load());
+    WL_INSTRUMENT(counters.edgesCreated = wordGraph.edgeCount());
+    // Thread buffers, plus the buffer list, the merged edge list and the three CSR arrays
+    WL_INSTRUMENT(counters.estimatedAllocations = bufferAllocations.load() + 5);
+    reportProgress(wordCount, edges.size(), 100);
+}
+
+/**
+ * @brief Sets the number of threads used by buildGraph
+ * @param count The thread count, or 0 to use every hardware thread
+ */
+void WordLadderGame::setThreadCount(unsigned count) {
+    threadCount = count;
+}
+
+/**
+ * @brief Gets the number of threads used by buildGraph
+ * @return The effective thread count, at least 1
+ */
+unsigned WordLadderGame::getThreadCount() const {
+    if (threadCount != 0) {
+        return threadCount;
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Selects how the next graph is held in memory
+ * @param mode The graph mode
+ */
+void WordLadderGame::setGraphMode(GraphMode mode) {
+    graphMode = mode;
+}
+
+/**
+ * @brief Gets the mode selected for the next graph
+ * @return The graph mode
+ */
+WordLadderGame::GraphMode WordLadderGame::getGraphMode() const {
+    return graphMode;
+}
+
+/**
+ * @brief Checks whether the current graph generates its neighbors instead of storing them
+ * @return true if the graph was built in implicit mode
+ */
+bool WordLadderGame::isImplicitGraph() const {
+    return implicitGraph;
+}
+
+/**
+ * @brief Loads a dictionary and its graph, using the binary graph cache when possible
+ * @param filename The path to the dictionary file
+ * @param wordLength The length of the words to keep, or 0 for the most common length
+ * @return true if the dictionary and graph are ready, false if the dictionary could not be loaded
+ * 
+ * If a cache file next to the dictionary matches it and holds words of the
+ * requested length, the word table and
+ * adjacency arrays are taken from the cache and no parsing or graph
+ * building happens. Otherwise the dictionary is loaded and the graph built
+ * as usual, and the result is written to the cache for the next time.
+ * Failing to write the cache (e.g. a read-only directory) is not an error,
+ * and a build stopped by the cancel flag is not cached. An implicit graph
+ * has no edges worth caching, so in that mode the dictionary is loaded and
+ * hashed directly.
+ */
+bool WordLadderGame::loadDictionaryWithCache(const std::string& filename, int wordLength) {
+    auto loadStart = std::chrono::steady_clock::now();
+    cancelled = false;
+    loadedFromCache = false;
+    if (graphMode == GraphMode::Implicit) {
+        if (!loadDictionary(filename, wordLength)) {
+            return false;
+        }
+        buildGraph();
+        return !cancelled;
+    }
+    const std::string cachePath = GraphCache::cachePathFor(filename);
+
+    GraphCache::Contents contents;
+    WL_INSTRUMENT(std::error_code cacheError);
+    if (GraphCache::read(cachePath, filename, contents)
+        && (wordLength == 0 || contents.wordLength == wordLength)) {
+        currentWordLength = contents.wordLength;
+        packedLaneBits = PackedWord::laneLowBits(static_cast<size_t>(currentWordLength));
+        neighborCollector = neighborCollectorFor(static_cast<size_t>(currentWordLength));
+        packedWords = std::move(contents.words);
+        sortedWordCount = packedWords.size();
+        removedWords.assign(packedWords.size(), false);
+        wordTable.build(packedWords);
+        implicitGraph = false;
+        std::vector<std::string_view>().swap(dictionary);
+        wordText.assign(packedWords, static_cast<size_t>(currentWordLength));
+        dictionaryStale = true;
+        wordGraph = WordGraph::fromArrays(packedWords, std::move(contents.offsets), std::move(contents.neighbors));
+        if (wordGraph.nodeCount() == packedWords.size()) {
+            finishGraph();
+            loadedFromCache = true;
+            lastLoadTimeMs = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - loadStart).count();
+            lastBuildTimeMs = 0.0;
+            instrumentation.load = LoadCounters();
+            instrumentation.load.wallMs = lastLoadTimeMs;
+            instrumentation.load.fromCache = true;
+            instrumentation.build = BuildCounters();
+            WL_INSTRUMENT(instrumentation.load.bytesRead = static_cast<size_t>(std::filesystem::file_size(cachePath, cacheError)));
+            WL_INSTRUMENT(instrumentation.load.wordsKept = packedWords.size());
+            WL_INSTRUMENT(instrumentation.load.estimatedAllocations = 7); // Three cached arrays, the word arena, the node table and the two word table arrays
+            WL_INSTRUMENT(instrumentation.build.edgesCreated = wordGraph.edgeCount());
+            reportProgress(packedWords.size(), wordGraph.edgeCount(), 100);
+            return true;
+        }
+        // Inconsistent arrays; fall through and rebuild
+    }
+
+    if (!loadDictionary(filename, wordLength)) {
+        return false;
+    }
+    buildGraph();
+    if (cancelled) {
+        return false;
+    }
+    GraphCache::write(cachePath, filename, currentWordLength, packedWords,
+                      wordGraph.getOffsets(), wordGraph.getNeighborArray());
+    return true;
+}
+
+/**
+ * @brief Checks whether the last loadDictionaryWithCache call used the cache
+ * @return true if the graph came from a cache file
+ */
+bool WordLadderGame::wasLoadedFromCache() const {
+    return loadedFromCache;
+}
+
+/**
+ * @brief Sets the function that receives load and build progress
+ * @param callback The progress receiver, or an empty function for none
+ */
+void WordLadderGame::setProgressCallback(ProgressCallback callback) {
+    progressCallback = std::move(callback);
+}
+
+/**
+ * @brief Sets a flag that aborts a running load or build when raised
+ * @param flag The flag to poll, or nullptr for none
+ */
+void WordLadderGame::setCancelFlag(const std::atomic<bool>* flag) {
+    cancelFlag = flag;
+}
+
+/**
+ * @brief Checks whether the last load or build was aborted by the cancel flag
+ * @return true if the cancel flag stopped the last load or build
+ */
+bool WordLadderGame::wasCancelled() const {
+    return cancelled;
+}
+
+/**
+ * @brief Passes a progress report to the progress callback, if any
+ * @param wordsRead Words accepted so far
+ * @param edgesFound Edges found so far
+ * @param percent Overall completion, 0 to 100
+ */
+void WordLadderGame::reportProgress(size_t wordsRead, size_t edgesFound, int percent) const {
+    if (progressCallback) {
+        BuildProgress progress;
+        progress.wordsRead = wordsRead;
+        progress.edgesFound = edgesFound;
+        progress.percent = percent;
+        progressCallback(progress);
+    }
+}
+
+/**
+ * @brief Polls the cancel flag and remembers a cancellation
+ * @return true if the running load or build should stop
+ *
+ * A relaxed load is enough: the flag carries no data, and a late
+ * observation only costs one more slice of work.
+ */
+bool WordLadderGame::cancelRequested() {
+    if (cancelFlag != nullptr && cancelFlag->load(std::memory_order_relaxed)) {
+        cancelled = true;
+    }
+    return cancelled;
+}
+
+/**
+ * @brief Rebuilds the indexes derived from a new word graph
+ * 
+ * Labels the connected components for reachability queries, drops the
+ * distance table of any game target and the ladder length index, and
+ * places landmark tables if the A* strategy is selected.
+ */
+void WordLadderGame::finishGraph() {
+    indexComponents();
+    targetDistance.clear(); // Any game target refers to the old graph
+    landmarks.clear();
+    landmarkDistances.clear();
+    landmarksStale = false;
+    ladderPools.clear();
+    probeOrder.clear();
+    probeCursor = 0;
+    longestLadder = -1;
+    ladderBound = 0;
+    if (searchStrategy == SearchStrategy::LandmarkAStar) {
+        precomputeLandmarks(defaultLandmarkCount);
+    }
+}
+
+/**
+ * @brief Adds a word to the dictionary and the graph
+ * @param word The word to add
+ * @return true if the word was added, false if it is invalid or already present
+ */
+bool WordLadderGame::addWord(const std::string& word) {
+    return editWords({word}, {}) == 1;
+}
+
+/**
+ * @brief Removes a word from the dictionary and the graph
+ * @param word The word to remove
+ * @return true if the word was removed, false if it is not in the dictionary
+ */
+bool WordLadderGame::removeWord(const std::string& word) {
+    return editWords({}, {word}) == 1;
+}
+
+/**
+ * @brief Adds and removes many words in one update of the graph
+ * @param additions Words to add; invalid and present words are skipped
+ * @param removals Words to remove; unknown words are skipped
+ * @return The number of distinct words edited
+ * 
+ * A word counts as edited when it is removed, added, or removed and added
+ * again by the same call; that last case counts once and leaves the word
+ * in the dictionary, with its neighbors found afresh.
+ * 
+ * Node IDs are never shifted or reused. A removed word keeps its node as a
+ * tombstone without neighbors, and an added word gets the next free ID,
+ * with its key filed in the word table; re-adding a removed word revives its old node. The neighbors of a word are
+ * found by looking up its 25 * length one-letter variants, so no edit scans
+ * the dictionary.
+ * 
+ * The new rows of the edited words and the patched rows of their neighbors
+ * are collected first and written to the graph once each. The component
+ * index follows in place: a removed word that had at most one neighbor
+ * cannot split its component, and an added word joins or merges the
+ * components of its neighbors through componentParent. Any other removal
+ * marks the index stale, to be relabeled on next use. Landmark distances
+ * only grow when words are removed, so the tables stay admissible; an
+ * addition may shorten ladders, so it drops them and they are placed again
+ * by the next findShortestPath. The sorted word list is rebuilt lazily by
+ * getDictionary. An implicit graph has no rows; its neighbors follow from
+ * the word table.
+ */
+size_t WordLadderGame::editWords(const std::vector<std::string>& additions, const std::vector<std::string>& removals) {
+    if (currentWordLength == 0 || wordGraph.nodeCount() != packedWords.size()) {
+        return 0; // No graph to edit
+    }
+    const size_t length = static_cast<size_t>(currentWordLength);
+    auto lowercase = [](std::string word) {
+        std::transform(word.begin(), word.end(), word.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return word;
+    };
+
+    // Apply the tombstones and new nodes; rows are rewritten below
+    std::vector<NodeId> edited;
+    std::vector<NodeId> scratch;
+    bool maySplit = false;
+    for (const std::string& word : removals) {
+        const NodeId id = findNode(lowercase(word));
+        if (id == WordGraph::invalidNode) {
+            continue;
+        }
+        removedWords[id] = true;
+        maySplit = maySplit || neighborsOf(id, scratch).size() > 1;
+        edited.push_back(id);
+    }
+    bool anyAdded = false;
+    for (const std::string& word : additions) {
+        const std::string lowered = lowercase(word);
+        PackedWord::Key key;
+        if (lowered.length() != length || !PackedWord::pack(lowered, key)) {
+            continue;
+        }
+        NodeId id = findKey(key);
+        if (id == WordGraph::invalidNode) {
+            id = wordGraph.addNode(key);
+            wordText.append(key);
+            packedWords.push_back(key);
+            wordTable.insert(key, id);
+            removedWords.push_back(false);
+            componentOf.push_back(WordGraph::invalidNode);
+        } else if (removedWords[id]) {
+            removedWords[id] = false;
+        } else {
+            continue; // Already in the dictionary
+        }
+        anyAdded = true;
+        edited.push_back(id);
+    }
+    if (edited.empty()) {
+        return 0;
+    }
+    // A word removed and added again in one call was edited once
+    std::sort(edited.begin(), edited.end());
+    edited.erase(std::unique(edited.begin(), edited.end()), edited.end());
+    auto isEdited = [&edited](NodeId id) { return std::binary_search(edited.begin(), edited.end(), id); };
+
+    // Rows of edited words are computed afresh; their neighbors' rows are
+    // copied once and patched. An implicit graph has no rows to update.
+    std::unordered_map<NodeId, std::vector<NodeId>> rows;
+    auto patchRow = [this, &rows](NodeId id) -> std::vector<NodeId>& {
+        auto it = rows.find(id);
+        if (it == rows.end()) {
+            const WordGraph::NeighborRange current = wordGraph.getNeighbors(id);
+            it = rows.emplace(id, std::vector<NodeId>(current.begin(), current.end())).first;
+        }
+        return it->second;
+    };
+    if (!implicitGraph) {
+        for (NodeId id : edited) {
+            for (NodeId neighbor : wordGraph.getNeighbors(id)) {
+                if (!isEdited(neighbor)) {
+                    std::vector<NodeId>& row = patchRow(neighbor);
+                    row.erase(std::remove(row.begin(), row.end(), id), row.end());
+                }
+            }
+            std::vector<NodeId>& row = rows[id];
+            row.clear();
+            if (!removedWords[id]) {
+                collectNeighbors(packedWords[id], row);
+                for (NodeId neighbor : row) {
+                    if (!isEdited(neighbor)) {
+                        patchRow(neighbor).push_back(id);
+                    }
+                }
+            }
+        }
+    }
+    for (auto& entry : rows) {
+        std::sort(entry.second.begin(), entry.second.end());
+        wordGraph.setNeighbors(entry.first, entry.second);
+    }
+
+    // Update the component index in place unless a component may have split
+    componentsStale = componentsStale || maySplit;
+    membersStale = true;
+    if (!componentsStale) {
+        for (NodeId id : edited) {
+            if (removedWords[id] && componentOf[id] != WordGraph::invalidNode) {
+                --componentSizes[componentRoot(componentOf[id])];
+                componentOf[id] = WordGraph::invalidNode;
+            }
+        }
+        for (NodeId id : edited) {
+            if (removedWords[id]) {
+                continue;
+            }
+            NodeId root = componentOf[id] == WordGraph::invalidNode ? WordGraph::invalidNode : componentRoot(componentOf[id]);
+            for (NodeId neighbor : neighborsOf(id, scratch)) {
+                if (componentOf[neighbor] == WordGraph::invalidNode) {
+                    continue; // Added later in this batch; it merges with this word then
+                }
+                NodeId other = componentRoot(componentOf[neighbor]);
+                if (root == WordGraph::invalidNode) {
+                    root = other;
+                    componentOf[id] = root;
+                    ++componentSizes[root];
+                } else if (other != root) {
+                    // Union by size keeps the parent chains logarithmic
+                    if (componentSizes[root] < componentSizes[other]) {
+                        std::swap(root, other);
+                    }
+                    componentParent[other] = root;
+                    componentSizes[root] += componentSizes[other];
+                }
+            }
+            if (root == WordGraph::invalidNode) {
+                componentOf[id] = static_cast<NodeId>(componentParent.size()); // A word on its own
+                componentParent.push_back(componentOf[id]);
+                componentSizes.push_back(1);
+            }
+        }
+    }
+
+    if (anyAdded) {
+        landmarks.clear();
+        landmarkDistances.clear();
+        landmarksStale = true;
+    }
+    targetDistance.clear(); // Distances to the game target may have changed
+    ladderPools.clear();
+    probeOrder.clear();
+    probeCursor = 0;
+    longestLadder = -1;
+    ladderBound = 0;
+    dictionaryStale = true;
+    return edited.size();
+}
+
+/**
+ * @brief Finds the shortest path between two words
+ * @param startWord The starting word
+ * @param endWord The target word
+ * @return A vector containing the words in the shortest path, or empty if no path exists
+ * 
+ * Runs the selected search strategy with the game's own search context and
+ * records its statistics. Landmarks dropped by editWords are placed again
+ * first. Returns an empty vector if either word is not in
+ * the dictionary or if no path exists.
+ */
+std::vector<std::string> WordLadderGame::findShortestPath(const std::string& startWord, const std::string& endWord) {
+    if (landmarksStale && searchStrategy == SearchStrategy::LandmarkAStar) {
+        precomputeLandmarks(defaultLandmarkCount); // Dropped by an edit
+    }
+    std::vector<std::string> path = findShortestPath(startWord, endWord, searchContext);
+    instrumentation.search = searchContext.stats;
+    return path;
+}
+
+/**
+ * @brief Finds the shortest path between two words using caller-owned scratch state
+ * @param startWord The starting word
+ * @param endWord The target word
+ * @param context The search context to use; its stats describe this query afterwards
+ * @return A vector containing the words in the shortest path, or empty if no path exists
+ * 
+ * The graph is only read, so concurrent calls are safe as long as each
+ * thread passes its own context. The neighbor source is chosen once per
+ * query, so the search loops are compiled separately for stored and
+ * generated neighbors and neither pays for the other.
+ */
+std::vector<std::string> WordLadderGame::findShortestPath(const std::string& startWord, const std::string& endWord,
+                                                          SearchContext& context) const {
+    context.beginQuery(wordGraph.nodeCount());
+
+    // Words outside the dictionary have no node ID
+    const NodeId startId = findNode(startWord);
+    const NodeId endId = findNode(endWord);
+    if (startId == WordGraph::invalidNode || endId == WordGraph::invalidNode) {
+        return {};
+    }
+
+    auto searchStart = std::chrono::steady_clock::now();
+    const bool found = implicitGraph ? runSearch(startId, endId, context, GeneratedNeighbors{this})
+                                     : runSearch(startId, endId, context, StoredNeighbors{&wordGraph});
+    context.stats.elapsedMicros = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - searchStart).count();
+
+    std::vector<std::string> path;
+    if (found) {
+        WL_INSTRUMENT(++context.stats.estimatedAllocations);
+        path.reserve(context.path.size());
+        for (NodeId id : context.path) {
+            path.emplace_back(wordText.word(id));
+        }
+    }
+    return path;
+}
+
+/**
+ * @brief Finds every shortest ladder between two words
+ * @param startWord The starting word
+ * @param endWord The target word
+ * @return The DAG of all minimal ladders, empty if either word is unknown or no ladder exists
+ */
+LadderDag WordLadderGame::findAllShortestPaths(const std::string& startWord, const std::string& endWord) {
+    LadderDag dag = findAllShortestPaths(startWord, endWord, searchContext);
+    instrumentation.search = searchContext.stats;
+    return dag;
+}
+
+/**
+ * @brief Finds every shortest ladder between two words using caller-owned scratch state
+ * @param startWord The starting word
+ * @param endWord The target word
+ * @param context The search context to use
+ * @return The DAG of all minimal ladders, empty if either word is unknown or no ladder exists
+ * 
+ * Runs the breadth-first search of findPathBreadthFirst once, which leaves
+ * the distance from the start of every node closer than the target. A node
+ * at distance i lies on a minimal ladder exactly when it neighbors a node
+ * at distance i + 1 that does, so the layers are peeled off backwards from
+ * the target, marking members on the backward side of the context with
+ * their index within the layer. A second pass over the members links each
+ * one to its neighbors in the next layer. No search runs per ladder, and
+ * the work is bounded by the BFS plus the edges around the DAG.
+ */
+LadderDag WordLadderGame::findAllShortestPaths(const std::string& startWord, const std::string& endWord,
+                                               SearchContext& context) const {
+    context.beginQuery(wordGraph.nodeCount());
+    const NodeId startId = findNode(startWord);
+    const NodeId endId = findNode(endWord);
+    if (startId == WordGraph::invalidNode || endId == WordGraph::invalidNode) {
+        return LadderDag();
+    }
+    const bool found = implicitGraph ? findPathBreadthFirst(startId, endId, context, GeneratedNeighbors{this})
+                                     : findPathBreadthFirst(startId, endId, context, StoredNeighbors{&wordGraph});
+    if (!found) {
+        return LadderDag();
+    }
+    const std::uint32_t moves = context.costs[endId];
+
+    // Peel the layers off from the target back to the start
+    std::vector<std::vector<NodeId>> layers(moves + 1);
+    layers[moves].push_back(endId);
+    context.visit(SearchContext::Backward, endId, 0);
+    for (std::uint32_t depth = moves; depth > 0; --depth) {
+        for (NodeId node : layers[depth]) {
+            for (NodeId neighbor : neighborsOf(node, context.neighbors)) {
+                if (context.isVisited(SearchContext::Forward, neighbor) && context.costs[neighbor] == depth - 1
+                    && context.visit(SearchContext::Backward, neighbor, static_cast<NodeId>(layers[depth - 1].size()))) {
+                    layers[depth - 1].push_back(neighbor);
+                }
+            }
+        }
+    }
+
+    // Number the members layer by layer and link each to the next layer
+    std::vector<std::uint32_t> layerOffsets(1, 0);
+    std::vector<std::string> words;
+    for (const std::vector<NodeId>& layer : layers) {
+        layerOffsets.push_back(layerOffsets.back() + static_cast<std::uint32_t>(layer.size()));
+        for (NodeId node : layer) {
+            words.emplace_back(wordText.word(node));
+        }
+    }
+    std::vector<std::uint32_t> successorOffsets(1, 0);
+    std::vector<std::uint32_t> successors;
+    for (std::uint32_t depth = 0; depth <= moves; ++depth) {
+        for (NodeId node : layers[depth]) {
+            if (depth < moves) {
+                for (NodeId neighbor : neighborsOf(node, context.neighbors)) {
+                    if (context.isVisited(SearchContext::Backward, neighbor) && context.costs[neighbor] == depth + 1) {
+                        successors.push_back(layerOffsets[depth + 1] + context.parent(SearchContext::Backward, neighbor));
+                    }
+                }
+            }
+            successorOffsets.push_back(static_cast<std::uint32_t>(successors.size()));
+        }
+    }
+    return LadderDag(std::move(words), std::move(layerOffsets), std::move(successorOffsets), std::move(successors));
+}
+
+/**
+ * @brief Runs the selected search strategy
+ * @param startId The starting node
+ * @param endId The target node
+ * @param context Scratch state, prepared by beginQuery; receives the path
+ * @param neighbors The neighbor source
+ * @return true if a path was found
+ */
+template <typename Neighbors>
+bool WordLadderGame::runSearch(NodeId startId, NodeId endId, SearchContext& context, const Neighbors& neighbors) const {
+    switch (searchStrategy) {
+    case SearchStrategy::BreadthFirst:
+        return findPathBreadthFirst(startId, endId, context, neighbors);
+    case SearchStrategy::Bidirectional:
+        return findPathBidirectional(startId, endId, context, neighbors);
+    case SearchStrategy::LandmarkAStar:
+        return findPathLandmarkAStar(startId, endId, context, neighbors);
+    }
+    return false;
+}
+
+/**
+ * @brief One-directional breadth-first search
+ * @param startId The starting node
+ * @param endId The target node
+ * @param context Scratch state, prepared by beginQuery; receives the path
+ * @param neighbors The neighbor source
+ * @return true if a path was found
+ * 
+ * Expands nodes in order of distance from the start until the target is
+ * dequeued. The distance of every reached node is left in context.costs,
+ * complete for all nodes closer than the target.
+ */
+template <typename Neighbors>
+bool WordLadderGame::findPathBreadthFirst(NodeId startId, NodeId endId, SearchContext& context,
+                                          const Neighbors& neighbors) const {
+    const SearchContext::Side side = SearchContext::Forward;
+    std::vector<NodeId>& queue = context.queue; // Queue of words to be visited, consumed from head
+    size_t head = 0;
+
+    queue.push_back(startId); // Adds the starting word to the queue
+    context.visit(side, startId, startId); // Marks the starting word as visited
+    context.costs[startId] = 0;
+
+    while (head < queue.size()) {
+        WL_INSTRUMENT(context.stats.peakFrontier = std::max(context.stats.peakFrontier, queue.size() - head));
+        NodeId current = queue[head++]; // Takes the first word in the queue
+        ++context.stats.nodesExpanded;
+
+        if (current == endId) {
+            // Reconstruct path by backtracking from the end word to the start word
+            for (NodeId id = endId; id != startId; id = context.parent(side, id)) {
+                context.path.push_back(id);
+            }
+            context.path.push_back(startId);
+            std::reverse(context.path.begin(), context.path.end()); // Reverses the path to get the correct order
+            return true;
+        }
+
+        for (NodeId neighbor : neighbors(current, context.neighbors)) {
+            WL_INSTRUMENT(++context.stats.edgesScanned);
+            if (context.visit(side, neighbor, current)) { // Records the parent of newly reached words
+                context.costs[neighbor] = context.costs[current] + 1;
+                queue.push_back(neighbor); // Adds the neighbor to the queue
+            }
+        }
+    }
+
+    return false; // No path found
+}
+
+/**
+ * @brief Bidirectional breadth-first search
+ * @param startId The starting node
+ * @param endId The target node
+ * @param context Scratch state, prepared by beginQuery; receives the path
+ * @param neighbors The neighbor source
+ * @return true if a path was found
+ * 
+ * Grows one search from each end, always expanding a whole level of the
+ * smaller frontier. A node is checked against the other side as soon as it
+ * is discovered, so the first meeting point lies on a shortest path; the
+ * two parent chains are then joined through it.
+ */
+template <typename Neighbors>
+bool WordLadderGame::findPathBidirectional(NodeId startId, NodeId endId, SearchContext& context,
+                                           const Neighbors& neighbors) const {
+    if (startId == endId) {
+        ++context.stats.nodesExpanded;
+        context.path.push_back(startId);
+        return true;
+    }
+
+    context.visit(SearchContext::Forward, startId, startId);
+    context.visit(SearchContext::Backward, endId, endId);
+    context.frontiers[SearchContext::Forward].push_back(startId);
+    context.frontiers[SearchContext::Backward].push_back(endId);
+
+    NodeId meeting = WordGraph::invalidNode;
+    while (meeting == WordGraph::invalidNode
+           && !context.frontiers[SearchContext::Forward].empty()
+           && !context.frontiers[SearchContext::Backward].empty()) {
+        const SearchContext::Side side =
+            context.frontiers[SearchContext::Forward].size() <= context.frontiers[SearchContext::Backward].size()
+                ? SearchContext::Forward : SearchContext::Backward;
+        const SearchContext::Side other = side == SearchContext::Forward ? SearchContext::Backward : SearchContext::Forward;
+        std::vector<NodeId>& frontier = context.frontiers[side];
+
+        context.nextFrontier.clear();
+        for (NodeId current : frontier) {
+            ++context.stats.nodesExpanded;
+            for (NodeId neighbor : neighbors(current, context.neighbors)) {
+                WL_INSTRUMENT(++context.stats.edgesScanned);
+                if (!context.visit(side, neighbor, current)) {
+                    continue;
+                }
+                if (context.isVisited(other, neighbor)) {
+                    meeting = neighbor; // The two searches touch here
+                    break;
+                }
+                context.nextFrontier.push_back(neighbor);
+            }
+            if (meeting != WordGraph::invalidNode) {
+                break;
+            }
+        }
+        frontier.swap(context.nextFrontier);
+        WL_INSTRUMENT(context.stats.peakFrontier = std::max(context.stats.peakFrontier,
+            context.frontiers[SearchContext::Forward].size() + context.frontiers[SearchContext::Backward].size()));
+    }
+
+    if (meeting == WordGraph::invalidNode) {
+        return false; // No path found
+    }
+
+    // Start -> meeting along the forward parents, then meeting -> end along the backward parents
+    for (NodeId id = meeting; id != startId; id = context.parent(SearchContext::Forward, id)) {
+        context.path.push_back(id);
+    }
+    context.path.push_back(startId);
+    std::reverse(context.path.begin(), context.path.end());
+    for (NodeId id = meeting; id != endId; ) {
+        id = context.parent(SearchContext::Backward, id);
+        context.path.push_back(id);
+    }
+    return true;
+}
+
+/**
+ * @brief A* search guided by landmark and Hamming lower bounds
+ * @param startId The starting node
+ * @param endId The target node
+ * @param context Scratch state, prepared by beginQuery; receives the path
+ * @param neighbors The neighbor source
+ * @return true if a path was found
+ * 
+ * Expands nodes in order of path cost plus lowerBound(). The bound is
+ * consistent, so a node's cost is final once it is closed and the first
+ * time the target is taken off the open list its path is a shortest one.
+ * Ties on the estimate are broken towards the deeper node.
+ */
+template <typename Neighbors>
+bool WordLadderGame::findPathLandmarkAStar(NodeId startId, NodeId endId, SearchContext& context,
+                                           const Neighbors& neighbors) const {
+    using OpenEntry = SearchContext::OpenEntry;
+    const SearchContext::Side side = SearchContext::Forward;
+    auto worse = [](const OpenEntry& a, const OpenEntry& b) {
+        return a.estimate > b.estimate || (a.estimate == b.estimate && a.cost < b.cost);
+    };
+
+    std::vector<OpenEntry>& open = context.open;
+    context.visit(side, startId, startId);
+    context.costs[startId] = 0;
+    open.push_back({lowerBound(startId, endId), 0, startId});
+
+    while (!open.empty()) {
+        std::pop_heap(open.begin(), open.end(), worse);
+        const OpenEntry entry = open.back();
+        open.pop_back();
+        if (entry.cost != context.costs[entry.node] || !context.close(entry.node)) {
+            continue; // Stale entry superseded by a cheaper one
+        }
+        ++context.stats.nodesExpanded;
+
+        if (entry.node == endId) {
+            for (NodeId id = endId; id != startId; id = context.parent(side, id)) {
+                context.path.push_back(id);
+            }
+            context.path.push_back(startId);
+            std::reverse(context.path.begin(), context.path.end());
+            return true;
+        }
+
+        const std::uint32_t nextCost = entry.cost + 1;
+        for (NodeId neighbor : neighbors(entry.node, context.neighbors)) {
+            WL_INSTRUMENT(++context.stats.edgesScanned);
+            if (context.visit(side, neighbor, entry.node)) {
+                context.costs[neighbor] = nextCost;
+            } else if (nextCost < context.costs[neighbor] && !context.isClosed(neighbor)) {
+                context.setParent(side, neighbor, entry.node);
+                context.costs[neighbor] = nextCost;
+            } else {
+                continue;
+            }
+            WL_INSTRUMENT(context.stats.estimatedAllocations += open.size() == open.capacity() ? 1 : 0);
+            open.push_back({nextCost + lowerBound(neighbor, endId), nextCost, neighbor});
+            std::push_heap(open.begin(), open.end(), worse);
+            WL_INSTRUMENT(context.stats.peakFrontier = std::max(context.stats.peakFrontier, open.size()));
+        }
+    }
+
+    return false; // No path found
+}
+
+/**
+ * @brief Lower bound on the number of moves between two nodes
+ * @param from The node to measure from
+ * @param to The node to measure to
+ * @return A consistent, admissible estimate of the ladder length
+ * 
+ * Every move changes one letter, so the Hamming distance is a bound. Each
+ * landmark L adds |d(L, to) - d(L, from)| by the triangle inequality, for
+ * landmarks that reach both nodes. The largest of these bounds is used.
+ */
+std::uint32_t WordLadderGame::lowerBound(NodeId from, NodeId to) const {
+    std::uint32_t bound = static_cast<std::uint32_t>(
+        PackedWord::differingLetters(packedWords[from], packedWords[to], packedLaneBits));
+
+    const size_t nodeCount = wordGraph.nodeCount();
+    for (size_t l = 0; l < landmarks.size(); ++l) {
+        const std::uint16_t* distances = landmarkDistances.data() + l * nodeCount;
+        const std::uint16_t fromDistance = distances[from];
+        const std::uint16_t toDistance = distances[to];
+        if (fromDistance == unreachableLandmark || toDistance == unreachableLandmark) {
+            continue;
+        }
+        const std::uint32_t difference = fromDistance > toDistance ? fromDistance - toDistance : toDistance - fromDistance;
+        bound = std::max(bound, difference);
+    }
+    return bound;
+}
+
+/**
+ * @brief Picks landmarks and precomputes their distance tables
+ * @param count The number of landmarks to place
+ * 
+ * Landmarks are placed in the largest connected component by farthest-point
+ * selection: the first is the node farthest from an arbitrary member, and
+ * each further landmark is the node whose distance to its nearest chosen
+ * landmark is largest. Spreading landmarks to the periphery makes their
+ * bounds tight for long ladders. Each table stores one 16-bit distance per node.
+ */
+void WordLadderGame::precomputeLandmarks(size_t count) {
+    refreshComponents();
+    landmarks.clear();
+    landmarkDistances.clear();
+    landmarksStale = false;
+    const size_t nodeCount = wordGraph.nodeCount();
+    if (nodeCount == 0 || count == 0) {
+        return;
+    }
+
+    // Locate the largest component
+    NodeId largest = 0;
+    for (NodeId c = 1; c + 1 < componentOffsets.size(); ++c) {
+        if (componentOffsets[c + 1] - componentOffsets[c] > componentOffsets[largest + 1] - componentOffsets[largest]) {
+            largest = c;
+        }
+    }
+    const size_t componentSize = componentOffsets[largest + 1] - componentOffsets[largest];
+    if (componentSize < 2) {
+        return; // No edges, nothing for a landmark to bound
+    }
+    count = std::min(count, componentSize);
+
+    // Fills one distance table by BFS and returns the farthest node reached
+    std::vector<NodeId> queue;
+    std::vector<NodeId> generated;
+    queue.reserve(componentSize);
+    auto fillDistances = [this, &queue, &generated](NodeId source, std::uint16_t* distances) {
+        queue.clear();
+        queue.push_back(source);
+        distances[source] = 0;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            const NodeId current = queue[head];
+            const std::uint16_t next = distances[current] == unreachableLandmark - 1
+                                           ? distances[current] : distances[current] + 1;
+            for (NodeId neighbor : neighborsOf(current, generated)) {
+                if (distances[neighbor] == unreachableLandmark) {
+                    distances[neighbor] = next;
+                    queue.push_back(neighbor);
+                }
+            }
+        }
+        return queue.back();
+    };
+
+    // Seed from the periphery: the farthest node from an arbitrary member
+    std::vector<std::uint16_t> scratch(nodeCount, unreachableLandmark);
+    NodeId next = fillDistances(componentMembers[componentOffsets[largest]], scratch.data());
+
+    std::vector<std::uint16_t> nearest(nodeCount, unreachableLandmark); // Distance to the closest landmark so far
+    landmarkDistances.assign(count * nodeCount, unreachableLandmark);
+    for (size_t l = 0; l < count; ++l) {
+        landmarks.push_back(next);
+        std::uint16_t* distances = landmarkDistances.data() + l * nodeCount;
+        fillDistances(next, distances);
+
+        std::uint16_t farthest = 0;
+        for (size_t i = componentOffsets[largest]; i < componentOffsets[largest + 1]; ++i) {
+            const NodeId node = componentMembers[i];
+            nearest[node] = std::min(nearest[node], distances[node]);
+            if (nearest[node] > farthest) {
+                farthest = nearest[node];
+                next = node;
+            }
+        }
+        if (farthest == 0) {
+            break; // Every node of the component is already a landmark
+        }
+    }
+    landmarkDistances.resize(landmarks.size() * nodeCount);
+}
 
 /**
- * @brief Constructs a new Word Ladder Game instance
+ * @brief Labels the connected components of the word graph
  * 
- * Initializes the random number generator with a time-based seed.
+ * Runs a breadth-first sweep over the graph, giving every word the ID of
+ * its component, then groups the members with groupComponents. Removed
+ * words belong to no component.
  */
-WordLadderGame::WordLadderGame() {
-    // Initialize random number generator with time-based seed
-    unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
-    randomEngine.seed(seed);
+void WordLadderGame::indexComponents() const {
+    const size_t nodeCount = wordGraph.nodeCount();
+    componentOf.assign(nodeCount, WordGraph::invalidNode);
+    componentParent.clear();
+    componentSizes.clear();
+
+    std::vector<NodeId> queue;
+    std::vector<NodeId> scratch;
+    queue.reserve(nodeCount);
+    for (NodeId root = 0; root < nodeCount; ++root) {
+        if (componentOf[root] != WordGraph::invalidNode || removedWords[root]) {
+            continue;
+        }
+        const NodeId component = static_cast<NodeId>(componentParent.size());
+        queue.clear();
+        componentOf[root] = component;
+        queue.push_back(root);
+        for (size_t head = 0; head < queue.size(); ++head) {
+            for (NodeId neighbor : neighborsOf(queue[head], scratch)) {
+                if (componentOf[neighbor] == WordGraph::invalidNode) {
+                    componentOf[neighbor] = component;
+                    queue.push_back(neighbor);
+                }
+            }
+        }
+        componentParent.push_back(component);
+        componentSizes.push_back(static_cast<NodeId>(queue.size()));
+    }
+    componentsStale = false;
+    groupComponents();
 }
 
 /**
- * @brief Loads a dictionary from a file
- * @param filename The path to the dictionary file
- * @return true if dictionary was loaded successfully, false otherwise
+ * @brief Groups the nodes by component, renumbering components densely
+ * 
+ * Resolves every label through componentParent and places the members of
+ * each component side by side, in node order, with all components of two
+ * or more words first, so that the words that can start a puzzle form one
+ * contiguous prefix of the member list. A counting pass sizes the groups,
+ * so this is linear in the number of words.
+ */
+void WordLadderGame::groupComponents() const {
+    const size_t nodeCount = wordGraph.nodeCount();
+    const size_t labelCount = componentParent.size();
+
+    // Surviving components, non-trivial first, keeping label order otherwise
+    std::vector<NodeId> order;
+    for (NodeId c = 0; c < labelCount; ++c) {
+        if (componentParent[c] == c && componentSizes[c] > 0) {
+            order.push_back(c);
+        }
+    }
+    std::stable_partition(order.begin(), order.end(), [this](NodeId c) {
+        return componentSizes[c] > 1;
+    });
+
+    std::vector<NodeId> newId(labelCount, WordGraph::invalidNode);
+    std::vector<NodeId> sizes(order.size());
+    componentOffsets.assign(1, 0);
+    pairableWordCount = 0;
+    for (NodeId c = 0; c < order.size(); ++c) {
+        newId[order[c]] = c;
+        sizes[c] = componentSizes[order[c]];
+        componentOffsets.push_back(componentOffsets.back() + sizes[c]);
+        if (sizes[c] > 1) {
+            pairableWordCount = componentOffsets.back();
+        }
+    }
+
+    componentMembers.assign(componentOffsets.back(), 0);
+    std::vector<NodeId> cursor(componentOffsets.begin(), componentOffsets.end() - 1);
+    for (NodeId node = 0; node < nodeCount; ++node) {
+        if (componentOf[node] != WordGraph::invalidNode) {
+            const NodeId component = newId[componentRoot(componentOf[node])];
+            componentOf[node] = component;
+            componentMembers[cursor[component]++] = node;
+        }
+    }
+
+    componentParent.resize(order.size());
+    for (NodeId c = 0; c < order.size(); ++c) {
+        componentParent[c] = c;
+    }
+    componentSizes.swap(sizes);
+    membersStale = false;
+}
+
+/**
+ * @brief Brings the component index up to date after edits
+ * 
+ * Relabels from scratch if a removal may have split a component, and
+ * otherwise only regroups the members of merged and shrunk components.
+ */
+void WordLadderGame::refreshComponents() const {
+    if (componentsStale) {
+        indexComponents();
+    } else if (membersStale) {
+        groupComponents();
+    }
+}
+
+/**
+ * @brief Gets the representative of a component after merges
+ * @param component A component label
+ * @return The label all components merged with it resolve to
+ */
+WordLadderGame::NodeId WordLadderGame::componentRoot(NodeId component) const {
+    while (componentParent[component] != component) {
+        component = componentParent[component];
+    }
+    return component;
+}
+
+/**
+ * @brief Checks whether a ladder exists between two words
+ * @param word1 The first word
+ * @param word2 The second word
+ * @return true if both words are in the dictionary and in the same connected component
  * 
- * Reads words from the specified file and stores them in the dictionary.
- * All words are converted to lowercase for consistency.
+ * A lookup in the component index built by buildGraph, following the
+ * merges made by editWords. Removals only mark the index stale, which keeps
+ * editWords proportional to the edited neighborhoods; the relabelling is
+ * deferred to the next query. That query writes the mutable index members,
+ * so concurrent calls are not safe.
  */
-bool WordLadderGame::loadDictionary(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
+bool WordLadderGame::areConnected(const std::string& word1, const std::string& word2) const {
+    const NodeId id1 = findNode(word1);
+    const NodeId id2 = findNode(word2);
+    if (id1 == WordGraph::invalidNode || id2 == WordGraph::invalidNode) {
         return false;
     }
+    if (componentsStale) {
+        indexComponents();
+    }
+    return componentRoot(componentOf[id1]) == componentRoot(componentOf[id2]);
+}
 
-    dictionary.clear();
-    std::string word;
-    while (std::getline(file, word)) {
-        // Convert to lowercase
-        std::transform(word.begin(), word.end(), word.begin(), ::tolower);
-        dictionary.push_back(word);
+/**
+ * @brief Picks two different words that are connected by a ladder
+ * @param startWord Receives the start word
+ * @param targetWord Receives the target word
+ * @return true if a pair was found, false if no two words are connected
+ * 
+ * The start word is drawn uniformly from all words that belong to a
+ * component with at least two words, and the target uniformly from the
+ * other members of that component. No search is run.
+ */
+bool WordLadderGame::getRandomConnectedPair(std::string& startWord, std::string& targetWord) const {
+    refreshComponents();
+    if (pairableWordCount == 0) {
+        return false;
     }
 
-    // Sort and remove duplicates
-    std::sort(dictionary.begin(), dictionary.end()); // Sorts the dictionary in alphabetical order
-    dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end()); // Removes duplicate words
+    std::uniform_int_distribution<size_t> startDist(0, pairableWordCount - 1);
+    const NodeId startId = componentMembers[startDist(randomEngine)];
+    const NodeId component = componentOf[startId];
+    const size_t begin = componentOffsets[component];
+    const size_t end = componentOffsets[component + 1];
 
-    // Set word length based on first word (assuming all words have same length)
-    if (!dictionary.empty()) {
-        currentWordLength = dictionary[0].length();
+    // Draw from the component minus the start word by skipping over its slot
+    std::uniform_int_distribution<size_t> targetDist(begin, end - 2);
+    size_t targetIndex = targetDist(randomEngine);
+    if (componentMembers[targetIndex] == startId) {
+        targetIndex = end - 1;
     }
 
+    startWord = wordText.word(startId);
+    targetWord = wordText.word(componentMembers[targetIndex]);
     return true;
 }
 
 /**
- * @brief Builds the word graph from the loaded dictionary
+ * @brief Picks two words whose shortest ladder has a given number of moves
+ * @param moves The required number of moves, at least 1
+ * @param startWord Receives the start word
+ * @param targetWord Receives the target word
+ * @return true if a pair was found, false if no ladder has that many moves
  * 
- * Creates edges between words that differ by exactly one letter.
- * The graph is built by comparing each word with every other word
- * in the dictionary.
+ * Each probed word contributes its count of words at every distance to the
+ * pool of that distance. The target is drawn from the pool with probability
+ * proportional to its count, and the start uniformly from the words at that
+ * distance from the target, which one breadth-first search stopping at the
+ * required depth finds. Every pair the probed words take part in is
+ * therefore equally likely.
+ * 
+ * Words are probed in random order. A draw probes until the pool of its
+ * length holds enough targets to vary the puzzles, but at most a few words,
+ * each a full search, so a draw stays short however large the graph; the
+ * pools widen over the games until every word is probed. Lengths up to
+ * getLongestLadder() are in the pools from the start. A length beyond the
+ * bound set with it cannot occur and is rejected without probing; one
+ * between the two is found only if a probe reaches it.
  */
-void WordLadderGame::buildGraph() {
-    wordGraph.clear(); // Clears the graph before building a new one
-
-    // Add all words as vertices
-    for (const auto& word : dictionary) {
-        wordGraph.addNode(word);
+bool WordLadderGame::getRandomPairAtDistance(int moves, std::string& startWord, std::string& targetWord) {
+    constexpr size_t poolTargets = 32;   // Targets sought before drawing from a pool
+    constexpr size_t probesPerDraw = 8;  // Full searches a single draw may run
+    if (moves <= 0 || getLongestLadder() == 0 || moves > ladderBound) {
+        return false;
+    }
+    const size_t length = static_cast<size_t>(moves);
+    auto poolSize = [this, length]() {
+        return length < ladderPools.size() ? ladderPools[length].targets.size() : 0;
+    };
+    for (size_t probes = 0; probes < probesPerDraw && poolSize() < poolTargets && probeCursor < probeOrder.size(); ++probes) {
+        probeLadders(probeOrder[probeCursor++]);
+    }
+    if (probeCursor == probeOrder.size()) {
+        ladderBound = longestLadder; // Every word was probed, so no longer ladder exists
+    }
+    if (poolSize() == 0) {
+        return false;
     }
 
-    // Add edges between words that differ by one letter
-    for (size_t i = 0; i < dictionary.size(); ++i) {
-        for (size_t j = i + 1; j < dictionary.size(); ++j) {
-            if (areWordsOneLetterApart(dictionary[i], dictionary[j])) {
-                wordGraph.addEdge(dictionary[i], dictionary[j]);
+    const LadderPool& pool = ladderPools[length];
+    std::uniform_int_distribution<std::uint64_t> pick(0, pool.cumulative.back() - 1);
+    const size_t index = static_cast<size_t>(
+        std::upper_bound(pool.cumulative.begin(), pool.cumulative.end(), pick(randomEngine)) - pool.cumulative.begin());
+    const NodeId targetId = pool.targets[index];
+
+    // Walk out from the target level by level, then pick within the last level
+    std::vector<NodeId>& queue = searchContext.queue;
+    searchContext.beginQuery(wordGraph.nodeCount());
+    searchContext.visit(SearchContext::Forward, targetId, targetId);
+    queue.push_back(targetId);
+    size_t levelStart = 0;
+    for (size_t depth = 0; depth < length; ++depth) {
+        const size_t levelEnd = queue.size();
+        for (size_t head = levelStart; head < levelEnd; ++head) {
+            for (NodeId neighbor : neighborsOf(queue[head], searchContext.neighbors)) {
+                if (searchContext.visit(SearchContext::Forward, neighbor, queue[head])) {
+                    queue.push_back(neighbor);
+                }
             }
         }
+        levelStart = levelEnd;
     }
+    std::uniform_int_distribution<size_t> startPick(levelStart, queue.size() - 1);
+    startWord = wordText.word(queue[startPick(randomEngine)]);
+    targetWord = wordText.word(targetId);
+    return true;
 }
 
 /**
- * @brief Finds the shortest path between two words
- * @param startWord The starting word
- * @param endWord The target word
- * @return A vector containing the words in the shortest path, or empty if no path exists
+ * @brief Gets the length of the longest ladder known to exist
+ * @return A number of moves such that every shorter or equal length has a pair, 0 if no two words are connected
  * 
- * Uses breadth-first search to find the shortest path between the start and end words.
- * Returns an empty vector if either word is not in the dictionary or if no path exists.
+ * Sets up the probe order and runs a double sweep on the largest
+ * component: the word farthest from an arbitrary member is close to the
+ * periphery, and its farthest word gives a lower bound on the diameter
+ * that is usually exact. Since a shortest ladder passes through every
+ * shorter distance from its end, the sweep's end word lands in the pool of
+ * every length up to the bound.
+ * 
+ * The first sweep also bounds the ladders from above: no two words of the
+ * largest component are more than twice the eccentricity of its first word
+ * apart, and no ladder in a smaller component is longer than its word count.
  */
-std::vector<std::string> WordLadderGame::findShortestPath(const std::string& startWord, const std::string& endWord) {
-    if (!isValidWord(startWord) || !isValidWord(endWord)) {
-        return {};
+int WordLadderGame::getLongestLadder() {
+    if (longestLadder >= 0) {
+        return longestLadder;
+    }
+    longestLadder = 0;
+    refreshComponents();
+    if (pairableWordCount == 0) {
+        return longestLadder;
+    }
+    probeOrder.assign(componentMembers.begin(), componentMembers.begin() + pairableWordCount);
+    std::shuffle(probeOrder.begin(), probeOrder.end(), randomEngine);
+    probeCursor = 0;
+
+    NodeId largest = 0;
+    for (NodeId c = 1; c + 1 < componentOffsets.size(); ++c) {
+        if (componentOffsets[c + 1] - componentOffsets[c] > componentOffsets[largest + 1] - componentOffsets[largest]) {
+            largest = c;
+        }
+    }
+    NodeId sweep = componentMembers[componentOffsets[largest]];
+    for (int round = 0; round < 2; ++round) {
+        // Move the word to the probed front of the order so it is not probed twice
+        std::swap(*std::find(probeOrder.begin() + probeCursor, probeOrder.end(), sweep), probeOrder[probeCursor]);
+        ++probeCursor;
+        sweep = probeLadders(sweep);
+        if (round == 0) {
+            ladderBound = 2 * longestLadder;
+        }
+    }
+    for (NodeId c = 0; c + 1 < componentOffsets.size(); ++c) {
+        if (c != largest) {
+            ladderBound = std::max(ladderBound, static_cast<int>(componentOffsets[c + 1] - componentOffsets[c]) - 1);
+        }
+    }
+    return longestLadder;
+}
+
+/**
+ * @brief Gets an upper bound on the length of every ladder
+ * @return A number of moves no shortest ladder exceeds, 0 if no two words are connected
+ * 
+ * The bound is set by getLongestLadder's first sweep and dropped with the
+ * ladder length index, so it always matches the current graph. Once
+ * getRandomPairAtDistance has probed every word it equals the longest
+ * ladder.
+ */
+int WordLadderGame::getLadderBound() {
+    getLongestLadder();
+    return ladderBound;
+}
+
+/**
+ * @brief Measures the shortest ladder between every pair of words
+ * @param keepDistances Whether to keep the distance matrix, one byte per ordered pair
+ * @return The eccentricities, ladder length histogram and diameter of the graph
+ */
+GraphStatistics WordLadderGame::computeStatistics(bool keepDistances) const {
+    if (implicitGraph) {
+        return computeStatisticsWith(keepDistances, GeneratedNeighbors{this});
+    }
+    return computeStatisticsWith(keepDistances, StoredNeighbors{&wordGraph});
+}
+
+/**
+ * @brief computeStatistics over one neighbor source
+ * @param keepDistances Whether to keep the distance matrix
+ * @param neighbors The neighbor source
+ * @return The statistics of the live words
+ * 
+ * A bit-parallel multi-source BFS: the live words are taken 64 at a time,
+ * and each node carries a 64-bit mask of the sources that have reached it
+ * (seen) and of those that reached it at the last level (frontier). One
+ * level ORs the frontier mask of every frontier node into its neighbors
+ * and keeps the bits they had not seen, so a single pass over the edges
+ * advances all 64 searches, and the popcount of the new bits feeds the
+ * histogram directly. A source's eccentricity is the last level at which
+ * its bit was new anywhere.
+ * 
+ * Batches are claimed from an atomic counter. Each thread owns its masks
+ * and histogram; eccentricities and matrix rows belong to one batch, so
+ * no two threads write the same entry.
+ */
+template <typename Neighbors>
+GraphStatistics WordLadderGame::computeStatisticsWith(bool keepDistances, const Neighbors& neighbors) const {
+    using Mask = std::uint64_t;
+    constexpr size_t batchSize = 64;
+    const size_t nodeCount = wordGraph.nodeCount();
+
+    // Live words get dense indices in node order
+    std::vector<NodeId> sources;
+    std::vector<std::uint32_t> indexOf(nodeCount, 0);
+    for (NodeId id = 0; id < nodeCount; ++id) {
+        if (!removedWords[id]) {
+            indexOf[id] = static_cast<std::uint32_t>(sources.size());
+            sources.push_back(id);
+        }
+    }
+    const size_t wordCount = sources.size();
+    std::vector<std::string> words;
+    words.reserve(wordCount);
+    for (NodeId id : sources) {
+        words.emplace_back(wordText.word(id));
+    }
+    std::vector<std::uint32_t> eccentricities(wordCount, 0);
+    std::vector<std::uint8_t> distances;
+    if (keepDistances) {
+        distances.assign(wordCount * wordCount, GraphStatistics::unreachable);
+        for (size_t i = 0; i < wordCount; ++i) {
+            distances[i * wordCount + i] = 0;
+        }
     }
 
-    std::queue<std::string> queue; // Queue to store the words to be visited
-    std::map<std::string, std::string> parent; // Maps each word to its parent in the shortest path
-    std::set<std::string> visited; // Set to store visited words
+    // A longest ladder found by one thread
+    struct Farthest {
+        std::uint32_t moves = 0; ///< Its length
+        size_t start = 0;        ///< Index of its first word
+        size_t end = 0;          ///< Index of its last word
+
+        bool operator<(const Farthest& other) const {
+            if (moves != other.moves) {
+                return moves < other.moves;
+            }
+            // Prefer the smaller pair, so the result does not depend on the thread count
+            return std::make_pair(start, end) > std::make_pair(other.start, other.end);
+        }
+    };
+
+    const size_t batchCount = (wordCount + batchSize - 1) / batchSize;
+    const unsigned threads = static_cast<unsigned>(
+        std::max<size_t>(1, std::min<size_t>(getThreadCount(), batchCount)));
+    std::vector<std::vector<std::uint64_t>> threadHistograms(threads);
+    std::vector<Farthest> threadFarthest(threads);
+    std::atomic<size_t> nextBatch(0);
+
+    auto work = [&](unsigned index) {
+        std::vector<Mask> seen(nodeCount);
+        std::vector<Mask> frontier(nodeCount);
+        std::vector<Mask> reached(nodeCount, 0);
+        std::vector<NodeId> scratch;
+        std::vector<std::uint64_t>& histogram = threadHistograms[index];
+        Farthest& farthest = threadFarthest[index];
+        for (;;) {
+            const size_t batch = nextBatch.fetch_add(1, std::memory_order_relaxed);
+            if (batch >= batchCount) {
+                break;
+            }
+            const size_t first = batch * batchSize;
+            const size_t count = std::min(batchSize, wordCount - first);
+            std::fill(seen.begin(), seen.end(), 0);
+            std::fill(frontier.begin(), frontier.end(), 0);
+            for (size_t bit = 0; bit < count; ++bit) {
+                seen[sources[first + bit]] = Mask(1) << bit;
+                frontier[sources[first + bit]] = Mask(1) << bit;
+            }
+
+            for (std::uint32_t level = 1; ; ++level) {
+                for (NodeId node = 0; node < nodeCount; ++node) {
+                    const Mask bits = frontier[node];
+                    if (bits != 0) {
+                        for (NodeId neighbor : neighbors(node, scratch)) {
+                            reached[neighbor] |= bits;
+                        }
+                    }
+                }
+
+                Mask levelBits = 0;
+                NodeId lastNode = 0;
+                Mask lastBits = 0;
+                std::uint64_t newPairs = 0;
+                for (NodeId node = 0; node < nodeCount; ++node) {
+                    const Mask fresh = reached[node] & ~seen[node];
+                    reached[node] = 0;
+                    frontier[node] = fresh;
+                    if (fresh == 0) {
+                        continue;
+                    }
+                    seen[node] |= fresh;
+                    levelBits |= fresh;
+                    newPairs += static_cast<std::uint64_t>(PackedWord::popcount64(fresh));
+                    if (lastBits == 0) {
+                        lastNode = node;
+                        lastBits = fresh;
+                    }
+                    if (keepDistances) {
+                        const std::uint8_t moves = static_cast<std::uint8_t>(
+                            std::min<std::uint32_t>(level, GraphStatistics::maxDistance));
+                        const size_t column = indexOf[node];
+                        for (Mask rest = fresh; rest != 0; rest &= rest - 1) {
+                            distances[(first + PackedWord::countTrailingZeros64(rest)) * wordCount + column] = moves;
+                        }
+                    }
+                }
+                if (levelBits == 0) {
+                    break;
+                }
+                if (histogram.size() <= level) {
+                    histogram.resize(level + 1, 0);
+                }
+                histogram[level] += newPairs;
+                for (Mask rest = levelBits; rest != 0; rest &= rest - 1) {
+                    eccentricities[first + PackedWord::countTrailingZeros64(rest)] = level;
+                }
+                Farthest candidate;
+                candidate.moves = level;
+                candidate.start = first + PackedWord::countTrailingZeros64(lastBits);
+                candidate.end = indexOf[lastNode];
+                if (farthest < candidate) {
+                    farthest = candidate;
+                }
+            }
+        }
+    };
 
-    queue.push(startWord); // Adds the starting word to the queue
-    visited.insert(startWord); // Adds the starting word to the visited set
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t) {
+        workers.emplace_back(work, t);
+    }
+    work(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
 
-    while (!queue.empty()) {
-        std::string current = queue.front(); // Gets the first word in the queue
-        queue.pop(); // Removes the first word from the queue
+    std::vector<std::uint64_t> histogram;
+    Farthest farthest;
+    for (unsigned t = 0; t < threads; ++t) {
+        if (histogram.size() < threadHistograms[t].size()) {
+            histogram.resize(threadHistograms[t].size(), 0);
+        }
+        for (size_t level = 0; level < threadHistograms[t].size(); ++level) {
+            histogram[level] += threadHistograms[t][level];
+        }
+        if (farthest < threadFarthest[t]) {
+            farthest = threadFarthest[t];
+        }
+    }
+    return GraphStatistics(std::move(words), std::move(eccentricities), std::move(histogram),
+                           std::move(distances), farthest.start, farthest.end);
+}
 
-        if (current == endWord) {
-            // Reconstruct path
-            std::vector<std::string> path; // Vector to store the path
-            std::string word = endWord; // Sets the end word as the current word    
-            while (word != startWord) { // Reconstructs the path by backtracking from the end word to the start word
-                path.push_back(word); // Adds the current word to the path
-                word = parent[word]; // Sets the parent of the current word as the next word in the path
+/**
+ * @brief Records how many words lie at each distance from a word
+ * @param source The word to search from
+ * @return The last word reached, one of the farthest from the source
+ * 
+ * Runs a breadth-first search level by level and appends the source to the
+ * pool of every distance it reaches, with the size of that level as weight.
+ */
+WordLadderGame::NodeId WordLadderGame::probeLadders(NodeId source) {
+    std::vector<NodeId>& queue = searchContext.queue;
+    searchContext.beginQuery(wordGraph.nodeCount());
+    searchContext.visit(SearchContext::Forward, source, source);
+    queue.push_back(source);
+    size_t levelStart = 0;
+    for (size_t depth = 1; ; ++depth) {
+        const size_t levelEnd = queue.size();
+        for (size_t head = levelStart; head < levelEnd; ++head) {
+            for (NodeId neighbor : neighborsOf(queue[head], searchContext.neighbors)) {
+                if (searchContext.visit(SearchContext::Forward, neighbor, queue[head])) {
+                    queue.push_back(neighbor);
+                }
             }
-            path.push_back(startWord); // Adds the starting word to the path
-            std::reverse(path.begin(), path.end()); // Reverses the path to get the correct order
-            return path; // Returns the path
         }
+        if (queue.size() == levelEnd) {
+            break; // The previous level was the last
+        }
+        if (ladderPools.size() <= depth) {
+            ladderPools.resize(depth + 1);
+        }
+        LadderPool& pool = ladderPools[depth];
+        pool.targets.push_back(source);
+        pool.cumulative.push_back((pool.cumulative.empty() ? 0 : pool.cumulative.back()) + (queue.size() - levelEnd));
+        longestLadder = std::max(longestLadder, static_cast<int>(depth));
+        levelStart = levelEnd;
+    }
+    return queue.back();
+}
+
+/**
+ * @brief Fixes the target word of a game and computes distances to it
+ * @param targetWord The word the player has to reach
+ * @return true if the target is in the dictionary, false otherwise
+ * 
+ * Runs one breadth-first search outward from the target and stores the
+ * distance of every node in a dense table. Since edges are undirected this
+ * is also the distance from each word to the target, so hint and scoring
+ * queries during the game only need to scan the current word's neighbors.
+ */
+bool WordLadderGame::setGameTarget(const std::string& targetWord) {
+    targetDistance.assign(wordGraph.nodeCount(), unreachable);
+    const NodeId targetId = findNode(targetWord);
+    if (targetId == WordGraph::invalidNode) {
+        return false;
+    }
 
-        for (const auto& neighbor : wordGraph.getNeighbors(current)) {
-            if (visited.find(neighbor) == visited.end()) {
-                visited.insert(neighbor); // Adds the neighbor to the visited set
-                parent[neighbor] = current; // Sets the parent of the neighbor as the current word
-                queue.push(neighbor); // Adds the neighbor to the queue
+    std::vector<NodeId>& queue = searchContext.queue;
+    searchContext.beginQuery(wordGraph.nodeCount());
+    queue.push_back(targetId);
+    targetDistance[targetId] = 0;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const NodeId current = queue[head];
+        for (NodeId neighbor : neighborsOf(current, searchContext.neighbors)) {
+            if (targetDistance[neighbor] == unreachable) {
+                targetDistance[neighbor] = targetDistance[current] + 1;
+                queue.push_back(neighbor);
             }
         }
     }
+    return true;
+}
+
+/**
+ * @brief Gets the number of moves from a word to the game target
+ * @param word The word to measure from
+ * @return The length of a shortest ladder to the target, or -1 if there is none
+ * 
+ * A single lookup in the table built by setGameTarget.
+ */
+int WordLadderGame::distanceToTarget(const std::string& word) const {
+    const NodeId id = findNode(word);
+    if (id == WordGraph::invalidNode || id >= targetDistance.size() || targetDistance[id] == unreachable) {
+        return -1;
+    }
+    return static_cast<int>(targetDistance[id]);
+}
+
+/**
+ * @brief Gets the next word on a shortest ladder towards the game target
+ * @param word The current word
+ * @return A neighbor one move closer to the target, or empty if there is none
+ * 
+ * Scans the neighbors of the word for one whose distance is one less.
+ * Among several optimal moves the one with the lowest node ID is returned.
+ */
+std::string WordLadderGame::nextOptimalWord(const std::string& word) const {
+    const int distance = distanceToTarget(word);
+    if (distance <= 0) {
+        return "";
+    }
+    std::vector<NodeId> scratch;
+    for (NodeId neighbor : neighborsOf(findNode(word), scratch)) {
+        if (targetDistance[neighbor] == static_cast<std::uint32_t>(distance - 1)) {
+            return std::string(wordText.word(neighbor));
+        }
+    }
+    return "";
+}
+
+/**
+ * @brief Checks whether a move keeps the player on a shortest ladder
+ * @param fromWord The word before the move
+ * @param toWord The word after the move
+ * @return true if toWord is one letter from fromWord and one move closer to the target
+ */
+bool WordLadderGame::isOptimalMove(const std::string& fromWord, const std::string& toWord) const {
+    const int fromDistance = distanceToTarget(fromWord);
+    const int toDistance = distanceToTarget(toWord);
+    return fromDistance > 0 && toDistance == fromDistance - 1 && areWordsOneLetterApart(fromWord, toWord);
+}
+
+/**
+ * @brief Selects the algorithm used by findShortestPath
+ * @param strategy The search strategy to use
+ * 
+ * Selecting LandmarkAStar computes the landmark tables if the current
+ * graph has none yet.
+ */
+void WordLadderGame::setSearchStrategy(SearchStrategy strategy) {
+    searchStrategy = strategy;
+    if (searchStrategy == SearchStrategy::LandmarkAStar && landmarks.empty()) {
+        precomputeLandmarks(defaultLandmarkCount);
+    }
+}
+
+/**
+ * @brief Gets the algorithm used by findShortestPath
+ * @return The current search strategy
+ */
+WordLadderGame::SearchStrategy WordLadderGame::getSearchStrategy() const {
+    return searchStrategy;
+}
+
+/**
+ * @brief Gets the landmarks used by the A* strategy
+ * @return The landmark words, in the order they were picked
+ */
+std::vector<std::string> WordLadderGame::getLandmarks() const {
+    std::vector<std::string> words;
+    words.reserve(landmarks.size());
+    for (NodeId id : landmarks) {
+        words.emplace_back(wordText.word(id));
+    }
+    return words;
+}
+
+/**
+ * @brief Gets the statistics of the last findShortestPath call
+ * @return Nodes expanded and elapsed time of the last query
+ */
+const SearchStats& WordLadderGame::getLastSearchStats() const {
+    return instrumentation.search;
+}
 
-    return {}; // No path found
+/**
+ * @brief Gets the counters of the last load, build and search
+ * @return The instrumentation record
+ */
+const Instrumentation& WordLadderGame::getInstrumentation() const {
+    return instrumentation;
 }
 
 /**
@@ -130,10 +1949,11 @@ std::vector<std::string> WordLadderGame::findShortestPath(const std::string& sta
  * @param word The word to check
  * @return true if the word is valid, false otherwise
  * 
- * Performs a binary search on the sorted dictionary to check if the word exists.
+ * Packs the word and looks it up in the word hash table, so the cost is a
+ * few integer operations whatever the dictionary size.
  */
 bool WordLadderGame::isValidWord(const std::string& word) const {
-    return std::binary_search(dictionary.begin(), dictionary.end(), word);
+    return findNode(word) != WordGraph::invalidNode;
 }
 
 /**
@@ -142,14 +1962,21 @@ bool WordLadderGame::isValidWord(const std::string& word) const {
  * @param word2 The second word
  * @return true if words differ by exactly one letter, false otherwise
  * 
- * Assumes both words are of the same length. Returns false if words
- * have different lengths.
+ * Returns false if words have different lengths. Lowercase words are
+ * compared as packed keys with the XOR/mask kernel; anything else falls
+ * back to a letter-by-letter comparison.
  */
 bool WordLadderGame::areWordsOneLetterApart(const std::string& word1, const std::string& word2) const {
     if (word1.length() != word2.length()) {
         return false;
     }
 
+    PackedWord::Key key1;
+    PackedWord::Key key2;
+    if (PackedWord::pack(word1, key1) && PackedWord::pack(word2, key2)) {
+        return PackedWord::oneLetterApart(key1, key2, PackedWord::laneLowBits(word1.length()));
+    }
+
     int differences = 0;
     for (size_t i = 0; i < word1.length(); ++i) {
         if (word1[i] != word2[i]) {
@@ -162,6 +1989,174 @@ bool WordLadderGame::areWordsOneLetterApart(const std::string& word1, const std:
     return differences == 1;
 }
 
+/**
+ * @brief Looks up the node ID of a word
+ * @param word The word to look up
+ * @return The word's node ID, or invalidNode if it is not in the dictionary
+ * 
+ * Packs the word and looks its key up with findKey. Words removed by
+ * editWords are not found.
+ */
+WordLadderGame::NodeId WordLadderGame::findNode(const std::string& word) const {
+    PackedWord::Key key;
+    if (word.length() != static_cast<size_t>(currentWordLength) || !PackedWord::pack(word, key)) {
+        return WordGraph::invalidNode;
+    }
+    const NodeId id = findKey(key);
+    if (id == WordGraph::invalidNode || removedWords[id]) {
+        return WordGraph::invalidNode;
+    }
+    return id;
+}
+
+/**
+ * @brief Looks up the node ID of a packed key, including removed words
+ * @param key The packed word
+ * @return The key's node ID, or invalidNode if it never had one
+ * 
+ * Every key, including those added by editWords, is filed in the word
+ * hash table under its node ID when the dictionary is loaded, so a lookup
+ * is one hash and usually a single probe instead of a binary search. Until
+ * the first edit, node IDs are dictionary indices.
+ */
+WordLadderGame::NodeId WordLadderGame::findKey(PackedWord::Key key) const {
+    const PackedWordTable::NodeId id = wordTable.find(key);
+    return id == PackedWordTable::notFound ? WordGraph::invalidNode : id;
+}
+
+/**
+ * @brief Collects the dictionary words one letter away from a key
+ * @param key The packed word
+ * @param neighbors Receives the node IDs of the words, sorted
+ * 
+ * Looks up every key that differs from this one in exactly one lane, so the
+ * cost depends on the word length, not the dictionary size. Calls the
+ * instance of collectNeighborsOfLength picked when the dictionary was
+ * loaded.
+ */
+void WordLadderGame::collectNeighbors(PackedWord::Key key, std::vector<NodeId>& neighbors) const {
+    (this->*neighborCollector)(key, neighbors);
+}
+
+/**
+ * @brief collectNeighbors for one word length known at compile time
+ * @tparam Length The word length
+ * @param key The packed word
+ * @param neighbors Receives the node IDs of the words, sorted
+ * 
+ * The positions are unrolled, so every lane shift and mask is a constant
+ * and only the 26-letter loop remains at run time.
+ */
+template <size_t Length>
+void WordLadderGame::collectNeighborsOfLength(PackedWord::Key key, std::vector<NodeId>& neighbors) const {
+    constexpr PackedWord::Key letterCount = 26;
+    forEachPosition([&](auto position) {
+        constexpr int shift = PackedWord::laneShift(decltype(position)::value, Length);
+        const PackedWord::Key cleared = key & ~(PackedWord::letterMask << shift);
+        const PackedWord::Key own = (key >> shift) & PackedWord::letterMask;
+        for (PackedWord::Key letter = 1; letter <= letterCount; ++letter) {
+            if (letter == own) {
+                continue;
+            }
+            const NodeId id = findKey(cleared | (letter << shift));
+            if (id != WordGraph::invalidNode && !removedWords[id]) {
+                neighbors.push_back(id);
+            }
+        }
+    }, std::make_index_sequence<Length>());
+    std::sort(neighbors.begin(), neighbors.end());
+}
+
+/**
+ * @brief Picks the collectNeighborsOfLength instance for a word length
+ * @param length The word length, at most PackedWord::maxLength
+ * @return The member function to call
+ */
+WordLadderGame::NeighborCollector WordLadderGame::neighborCollectorFor(size_t length) {
+    static const NeighborCollector collectors[] = {
+        &WordLadderGame::collectNeighborsOfLength<0>,  &WordLadderGame::collectNeighborsOfLength<1>,
+        &WordLadderGame::collectNeighborsOfLength<2>,  &WordLadderGame::collectNeighborsOfLength<3>,
+        &WordLadderGame::collectNeighborsOfLength<4>,  &WordLadderGame::collectNeighborsOfLength<5>,
+        &WordLadderGame::collectNeighborsOfLength<6>,  &WordLadderGame::collectNeighborsOfLength<7>,
+        &WordLadderGame::collectNeighborsOfLength<8>,  &WordLadderGame::collectNeighborsOfLength<9>,
+        &WordLadderGame::collectNeighborsOfLength<10>, &WordLadderGame::collectNeighborsOfLength<11>,
+        &WordLadderGame::collectNeighborsOfLength<12>,
+    };
+    static_assert(sizeof(collectors) / sizeof(collectors[0]) == PackedWord::maxLength + 1,
+                  "one instance per packable word length");
+    return collectors[length <= PackedWord::maxLength ? length : 0];
+}
+
+/**
+ * @brief Gets the neighbors of a node
+ * @param id The node
+ * @param scratch Receives the neighbors; the range points into it
+ * @return The neighbors present in the dictionary, sorted
+ * 
+ * Sorting keeps the expansion order, and so the ladders found, the same
+ * as in a materialized graph, whose rows are sorted by node ID.
+ */
+WordLadderGame::NeighborRange WordLadderGame::GeneratedNeighbors::operator()(NodeId id, std::vector<NodeId>& scratch) const {
+    scratch.clear();
+    game->collectNeighbors(game->packedWords[id], scratch);
+    return NeighborRange(scratch.data(), scratch.data() + scratch.size());
+}
+
+/**
+ * @brief Gets the neighbors of a node from whichever source the graph uses
+ * @param id The node
+ * @param scratch Buffer for generated neighbors; the range may point into it
+ * @return The neighbors, valid until scratch is next changed
+ */
+WordLadderGame::NeighborRange WordLadderGame::neighborsOf(NodeId id, std::vector<NodeId>& scratch) const {
+    if (implicitGraph) {
+        return GeneratedNeighbors{this}(id, scratch);
+    }
+    return wordGraph.getNeighbors(id);
+}
+
+/**
+ * @brief Unloads every word
+ * 
+ * Empties the word list, the word table, the text arena and the edit marks
+ * and resets the word length, so that no word is found until the next load.
+ */
+void WordLadderGame::clearWords() {
+    std::vector<std::string_view>().swap(dictionary);
+    wordText.clear();
+    packedWords.clear();
+    sortedWordCount = 0;
+    removedWords.clear();
+    dictionaryStale = false;
+    wordTable.clear();
+    currentWordLength = 0;
+}
+
+/**
+ * @brief Drops removed words and restores the sorted word table before a full build
+ * 
+ * Does nothing unless words were edited since the last load. Afterwards
+ * node IDs are dictionary indices again.
+ */
+void WordLadderGame::normalizeWords() {
+    if (sortedWordCount == packedWords.size() && std::find(removedWords.begin(), removedWords.end(), true) == removedWords.end()) {
+        return;
+    }
+    size_t kept = 0;
+    for (size_t i = 0; i < packedWords.size(); ++i) {
+        if (!removedWords[i]) {
+            packedWords[kept++] = packedWords[i];
+        }
+    }
+    packedWords.resize(kept);
+    std::sort(packedWords.begin(), packedWords.end());
+    sortedWordCount = kept;
+    removedWords.assign(kept, false);
+    wordTable.build(packedWords);
+    wordText.assign(packedWords, static_cast<size_t>(currentWordLength));
+    dictionaryStale = true;
+}
+
 /**
  * @brief Gets a random word from the dictionary
  * @return A random word from the dictionary, or empty string if dictionary is empty
@@ -169,19 +2164,43 @@ bool WordLadderGame::areWordsOneLetterApart(const std::string& word1, const std:
  * Uses the random number generator to select a random word from the dictionary.
  */
 std::string WordLadderGame::getRandomWord() const {
-    if (dictionary.empty()) {
+    const std::vector<std::string_view>& words = getDictionary();
+    if (words.empty()) {
         return "";
     }
 
-    std::uniform_int_distribution<size_t> dist(0, dictionary.size() - 1);
-    return dictionary[dist(randomEngine)];
+    std::uniform_int_distribution<size_t> dist(0, words.size() - 1);
+    return std::string(words[dist(randomEngine)]);
 }
 
 /**
  * @brief Gets the current dictionary
- * @return A const reference to the vector of words in the dictionary
+ * @return A const reference to the words in the dictionary, sorted
+ * 
+ * Lists views of the live words in the word arena. Node IDs follow key
+ * order, which is alphabetical order, up to the first added word, so the
+ * IDs are only sorted by key when editWords has appended words.
  */
-const std::vector<std::string>& WordLadderGame::getDictionary() const {
+const std::vector<std::string_view>& WordLadderGame::getDictionary() const {
+    if (dictionaryStale) {
+        std::vector<NodeId> ids;
+        ids.reserve(packedWords.size());
+        for (size_t i = 0; i < packedWords.size(); ++i) {
+            if (!removedWords[i]) {
+                ids.push_back(static_cast<NodeId>(i));
+            }
+        }
+        if (sortedWordCount != packedWords.size()) {
+            std::sort(ids.begin(), ids.end(),
+                      [this](NodeId a, NodeId b) { return packedWords[a] < packedWords[b]; });
+        }
+        dictionary.clear();
+        dictionary.reserve(ids.size());
+        for (NodeId id : ids) {
+            dictionary.push_back(wordText.word(id));
+        }
+        dictionaryStale = false;
+    }
     return dictionary;
 }
 
@@ -192,3 +2211,56 @@ const std::vector<std::string>& WordLadderGame::getDictionary() const {
 int WordLadderGame::getWordLength() const {
     return currentWordLength;
 }
+
+/**
+ * @brief Gets the time taken by the last dictionary load
+ * @return The wall-clock duration of the last loadDictionary call in milliseconds
+ */
+double WordLadderGame::getLastLoadTimeMs() const {
+    return lastLoadTimeMs;
+}
+
+/**
+ * @brief Gets the time taken by the last graph build
+ * @return The wall-clock duration of the last buildGraph call in milliseconds
+ */
+double WordLadderGame::getLastBuildTimeMs() const {
+    return lastBuildTimeMs;
+}
+
+/**
+ * @brief Gets the number of edges in the word graph
+ * @return The number of pairs of words one letter apart
+ */
+size_t WordLadderGame::getEdgeCount() const {
+    return wordGraph.edgeCount();
+}
+
+/**
+ * @brief Estimates the memory held by the game
+ * @return The bytes allocated for the dictionary, the graph and all tables derived from it
+ * 
+ * Counts the capacity of every array, so the figure tracks what a
+ * resident graph actually costs. Word text lives only in the arena; the
+ * graph and the dictionary hold keys and views. Allocator overhead is not
+ * included.
+ */
+size_t WordLadderGame::memoryUsage() const {
+    size_t bytes = sizeof(*this);
+    bytes += wordText.memoryUsage();
+    bytes += dictionary.capacity() * sizeof(std::string_view);
+    bytes += wordGraph.memoryUsage();
+    bytes += packedWords.capacity() * sizeof(PackedWord::Key);
+    bytes += wordTable.memoryUsage();
+    bytes += removedWords.capacity() / 8;
+    bytes += (componentOf.capacity() + componentMembers.capacity() + componentOffsets.capacity()
+              + componentParent.capacity() + componentSizes.capacity() + landmarks.capacity()) * sizeof(NodeId);
+    bytes += targetDistance.capacity() * sizeof(std::uint32_t);
+    bytes += landmarkDistances.capacity() * sizeof(std::uint16_t);
+    bytes += ladderPools.capacity() * sizeof(LadderPool) + probeOrder.capacity() * sizeof(NodeId);
+    for (const LadderPool& pool : ladderPools) {
+        bytes += pool.targets.capacity() * sizeof(NodeId) + pool.cumulative.capacity() * sizeof(std::uint64_t);
+    }
+    bytes += searchContext.memoryUsage();
+    return bytes;
+}
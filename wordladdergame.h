@@ -2,7 +2,15 @@
 #define WORDLADDERGAME_H
 
 #include "graph.h"
+#include "searchcontext.h"
+#include "packedword.h"
+#include "packedwordtable.h"
+#include "wordarena.h"
+#include "instrumentation.h"
+#include "ladderdag.h"
+#include "graphstats.h"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <queue>
 #include <map>
@@ -10,6 +18,8 @@
 #include <fstream>
 #include <algorithm> // For std::shuffle, std::remove
 #include <random>    // For std::mt19937, std::uniform_int_distribution
+#include <functional>
+#include <atomic>
 
 /**
  * @class WordLadderGame
@@ -20,6 +30,42 @@
  */
 class WordLadderGame {
 public:
+    /**
+     * @brief Algorithms available to findShortestPath
+     */
+    enum class SearchStrategy {
+        BreadthFirst,  ///< One-directional BFS from the start word
+        Bidirectional, ///< BFS from both ends, expanding the smaller frontier
+        LandmarkAStar  ///< A* with landmark (ALT) and Hamming lower bounds
+    };
+
+    /**
+     * @brief How the word graph is held in memory
+     */
+    enum class GraphMode {
+        Materialized, ///< Adjacency lists built once by buildGraph
+        Implicit      ///< No edges stored; neighbors generated from a hashed word set when expanded
+    };
+
+    static constexpr size_t defaultLandmarkCount = 8; ///< Landmarks placed when A* is selected
+
+    /**
+     * @struct BuildProgress
+     * @brief Progress of a dictionary load and graph build
+     */
+    struct BuildProgress {
+        size_t wordsRead = 0;  ///< Words accepted from the dictionary so far
+        size_t edgesFound = 0; ///< Edges found by the graph build so far
+        int percent = 0;       ///< Overall completion, 0 to 100
+    };
+
+    /**
+     * @brief Receives progress reports during loading and building
+     *
+     * Called on the thread doing the work.
+     */
+    using ProgressCallback = std::function<void(const BuildProgress&)>;
+
     /**
      * @brief Constructs a new Word Ladder Game instance
      */
@@ -28,17 +74,137 @@ public:
     /**
      * @brief Loads a dictionary from a file
      * @param filename The path to the dictionary file
+     * @param wordLength The length of the words to keep, or 0 for the most common length
      * @return true if dictionary was loaded successfully, false otherwise
+     *
+     * Words are lowercased; blank lines, words of another length, words
+     * longer than PackedWord::maxLength and words containing non-letters
+     * are skipped.
      */
-    bool loadDictionary(const std::string& filename);
+    bool loadDictionary(const std::string& filename, int wordLength = 0);
 
     /**
      * @brief Builds the word graph from the loaded dictionary
      * 
-     * Creates edges between words that differ by exactly one letter.
+     * Creates edges between words that differ by exactly one letter,
+     * using a wildcard-pattern index instead of a pairwise scan. Edge
+     * discovery is spread over getThreadCount() threads.
      */
     void buildGraph();
 
+    /**
+     * @brief Sets the number of threads used by buildGraph
+     * @param count The thread count, or 0 to use every hardware thread
+     */
+    void setThreadCount(unsigned count);
+
+    /**
+     * @brief Gets the number of threads used by buildGraph
+     * @return The effective thread count, at least 1
+     */
+    unsigned getThreadCount() const;
+
+    /**
+     * @brief Selects how the next graph is held in memory
+     * @param mode The graph mode
+     *
+     * Takes effect at the next buildGraph or loadDictionaryWithCache call;
+     * the current graph keeps its mode until then.
+     */
+    void setGraphMode(GraphMode mode);
+
+    /**
+     * @brief Gets the mode selected for the next graph
+     * @return The graph mode
+     */
+    GraphMode getGraphMode() const;
+
+    /**
+     * @brief Checks whether the current graph generates its neighbors instead of storing them
+     * @return true if the graph was built in implicit mode
+     */
+    bool isImplicitGraph() const;
+
+    /**
+     * @brief Loads a dictionary and its graph, using the binary graph cache when possible
+     * @param filename The path to the dictionary file
+     * @param wordLength The length of the words to keep, or 0 for the most common length
+     * @return true if the dictionary and graph are ready, false if the dictionary could not be loaded
+     *
+     * Equivalent to loadDictionary followed by buildGraph, except that a
+     * current cache file of words of that length is used instead when present,
+     * and a new one is written otherwise. In implicit mode there are no edges
+     * to cache, so the dictionary is always read.
+     */
+    bool loadDictionaryWithCache(const std::string& filename, int wordLength = 0);
+
+    /**
+     * @brief Checks whether the last loadDictionaryWithCache call used the cache
+     * @return true if the graph came from a cache file
+     */
+    bool wasLoadedFromCache() const;
+
+    /**
+     * @brief Sets the function that receives load and build progress
+     * @param callback The progress receiver, or an empty function for none
+     *
+     * Loading reports up to 30 percent, building the rest. Reports are
+     * spaced out so that the callback may forward them to another thread.
+     */
+    void setProgressCallback(ProgressCallback callback);
+
+    /**
+     * @brief Sets a flag that aborts a running load or build when raised
+     * @param flag The flag to poll, or nullptr for none; must outlive the load
+     *
+     * The flag may be raised from any thread. An aborted load returns false
+     * and an aborted build leaves the game without words or a graph, as
+     * before the first load; wasCancelled() tells the two failures apart.
+     */
+    void setCancelFlag(const std::atomic<bool>* flag);
+
+    /**
+     * @brief Checks whether the last load or build was aborted by the cancel flag
+     * @return true if the cancel flag stopped the last load or build
+     */
+    bool wasCancelled() const;
+
+    /**
+     * @brief Adds a word to the dictionary and the graph
+     * @param word The word to add
+     * @return true if the word was added, false if it is invalid or already present
+     *
+     * Requires a built graph. Only the new word and its neighbors are
+     * touched; see editWords.
+     */
+    bool addWord(const std::string& word);
+
+    /**
+     * @brief Removes a word from the dictionary and the graph
+     * @param word The word to remove
+     * @return true if the word was removed, false if it is not in the dictionary
+     *
+     * Requires a built graph. Only the word and its neighbors are touched;
+     * see editWords.
+     */
+    bool removeWord(const std::string& word);
+
+    /**
+     * @brief Adds and removes many words in one update of the graph
+     * @param additions Words to add; invalid and present words are skipped
+     * @param removals Words to remove; unknown words are skipped
+     * @return The number of distinct words edited
+     *
+     * Removals are applied before additions, so a word in both lists stays
+     * in the dictionary. Every word that was removed, added, or both counts
+     * as one edit; skipped words do not count. The rows of the edited words and their neighbors are
+     * rewritten once each, in time proportional to the number of affected
+     * neighbors. Node IDs of untouched words do not change. Landmark tables
+     * are dropped when words are added and the game target, if any, must be
+     * set again. Requires a built graph.
+     */
+    size_t editWords(const std::vector<std::string>& additions, const std::vector<std::string>& removals);
+
     /**
      * @brief Finds the shortest path between two words
      * @param startWord The starting word
@@ -47,6 +213,183 @@ public:
      */
     std::vector<std::string> findShortestPath(const std::string& startWord, const std::string& endWord);
 
+    /**
+     * @brief Finds the shortest path between two words using caller-owned scratch state
+     * @param startWord The starting word
+     * @param endWord The target word
+     * @param context The search context to use; its stats describe this query afterwards
+     * @return A vector containing the words in the shortest path, or empty if no path exists
+     *
+     * Does not modify the game, so it may run concurrently with one context
+     * per thread. After words were added, A* runs on Hamming bounds alone
+     * until the landmarks are placed again.
+     */
+    std::vector<std::string> findShortestPath(const std::string& startWord, const std::string& endWord,
+                                              SearchContext& context) const;
+
+    /**
+     * @brief Finds every shortest ladder between two words
+     * @param startWord The starting word
+     * @param endWord The target word
+     * @return The DAG of all minimal ladders, empty if either word is unknown or no ladder exists
+     */
+    LadderDag findAllShortestPaths(const std::string& startWord, const std::string& endWord);
+
+    /**
+     * @brief Finds every shortest ladder between two words using caller-owned scratch state
+     * @param startWord The starting word
+     * @param endWord The target word
+     * @param context The search context to use
+     * @return The DAG of all minimal ladders, empty if either word is unknown or no ladder exists
+     *
+     * Does not modify the game, so it may run concurrently with one context per thread.
+     */
+    LadderDag findAllShortestPaths(const std::string& startWord, const std::string& endWord,
+                                   SearchContext& context) const;
+
+    /**
+     * @brief Selects the algorithm used by findShortestPath
+     * @param strategy The search strategy to use
+     *
+     * Selecting LandmarkAStar places the landmark tables if the graph has
+     * none, which runs several full searches; callers that must stay
+     * responsive call precomputeLandmarks beforehand, off their thread.
+     */
+    void setSearchStrategy(SearchStrategy strategy);
+
+    /**
+     * @brief Gets the algorithm used by findShortestPath
+     * @return The current search strategy
+     */
+    SearchStrategy getSearchStrategy() const;
+
+    /**
+     * @brief Picks landmarks and precomputes their distance tables
+     * @param count The number of landmarks to place
+     *
+     * Called automatically when LandmarkAStar is selected or the graph is
+     * rebuilt with it selected; call directly to change the landmark count.
+     */
+    void precomputeLandmarks(size_t count);
+
+    /**
+     * @brief Gets the landmarks used by the A* strategy
+     * @return The landmark words, in the order they were picked
+     */
+    std::vector<std::string> getLandmarks() const;
+
+    /**
+     * @brief Gets the statistics of the last findShortestPath call
+     * @return Nodes expanded and elapsed time of the last query
+     */
+    const SearchStats& getLastSearchStats() const;
+
+    /**
+     * @brief Gets the counters of the last load, build and search
+     * @return The instrumentation record; counters other than wall times
+     *         are zero when WORDLADDER_INSTRUMENTATION is disabled
+     */
+    const Instrumentation& getInstrumentation() const;
+
+    /**
+     * @brief Checks whether a ladder exists between two words
+     * @param word1 The first word
+     * @param word2 The second word
+     * @return true if both words are in the dictionary and in the same connected component
+     *
+     * Not thread-safe, although const: the first call after an editWords
+     * removal relabels the components through mutable members. Callers
+     * that share a game between threads serialize it like editWords.
+     */
+    bool areConnected(const std::string& word1, const std::string& word2) const;
+
+    /**
+     * @brief Picks two different words that are connected by a ladder
+     * @param startWord Receives the start word
+     * @param targetWord Receives the target word
+     * @return true if a pair was found, false if no two words are connected
+     *
+     * Not thread-safe, although const: it draws from the game's random
+     * engine and may regroup the component index after edits.
+     */
+    bool getRandomConnectedPair(std::string& startWord, std::string& targetWord) const;
+
+    /**
+     * @brief Picks two words whose shortest ladder has a given number of moves
+     * @param moves The required number of moves, at least 1
+     * @param startWord Receives the start word
+     * @param targetWord Receives the target word
+     * @return true if a pair was found, false if no ladder has that many moves
+     *
+     * Pairs are drawn from a lazily built index of ladder lengths; once the
+     * index covers a length, a draw costs one search bounded by that length.
+     * Lengths up to getLongestLadder() always succeed. A draw runs at most a
+     * few full searches to widen the index, and none for lengths that the
+     * graph's components rule out.
+     */
+    bool getRandomPairAtDistance(int moves, std::string& startWord, std::string& targetWord);
+
+    /**
+     * @brief Gets the length of the longest ladder known to exist
+     * @return A number of moves such that every shorter or equal length has a pair, 0 if no two words are connected
+     *
+     * The first call runs two breadth-first searches; later draws may raise
+     * the figure as they discover longer ladders.
+     */
+    int getLongestLadder();
+
+    /**
+     * @brief Gets an upper bound on the length of every ladder
+     * @return A number of moves no shortest ladder exceeds, 0 if no two words are connected
+     *
+     * Found by the first getLongestLadder call, which this runs if needed.
+     * getRandomPairAtDistance turns down longer lengths without a search;
+     * lengths between getLongestLadder() and this bound may or may not exist
+     * until every word has been probed, when the two meet.
+     */
+    int getLadderBound();
+
+    /**
+     * @brief Measures the shortest ladder between every pair of words
+     * @param keepDistances Whether to keep the distance matrix, one byte per ordered pair
+     * @return The eccentricities, ladder length histogram and diameter of the graph
+     *
+     * Runs a breadth-first search from every word, 64 sources at a time, on
+     * getThreadCount() threads. Must not race with editWords.
+     */
+    GraphStatistics computeStatistics(bool keepDistances = false) const;
+
+    /**
+     * @brief Fixes the target word of a game and computes distances to it
+     * @param targetWord The word the player has to reach
+     * @return true if the target is in the dictionary, false otherwise
+     *
+     * Must be called again after the graph is rebuilt or edited.
+     */
+    bool setGameTarget(const std::string& targetWord);
+
+    /**
+     * @brief Gets the number of moves from a word to the game target
+     * @param word The word to measure from
+     * @return The length of a shortest ladder to the target, or -1 if there is none
+     */
+    int distanceToTarget(const std::string& word) const;
+
+    /**
+     * @brief Gets the next word on a shortest ladder towards the game target
+     * @param word The current word
+     * @return A neighbor one move closer to the target, or empty if there is none
+     */
+    std::string nextOptimalWord(const std::string& word) const;
+
+    /**
+     * @brief Checks whether a move keeps the player on a shortest ladder
+     * @param fromWord The word before the move
+     * @param toWord The word after the move
+     * @return true if toWord is one letter from fromWord and one move closer to the target
+     */
+    bool isOptimalMove(const std::string& fromWord, const std::string& toWord) const;
+
     /**
      * @brief Checks if a word is valid (exists in the dictionary)
      * @param word The word to check
@@ -70,9 +413,13 @@ public:
 
     /**
      * @brief Gets the current dictionary
-     * @return A const reference to the vector of words in the dictionary
+     * @return A const reference to the words in the dictionary, sorted
+     *
+     * The views point into the game's word storage and stay valid until the
+     * dictionary is edited or replaced. The list is built on the first call
+     * after a load or an edit.
      */
-    const std::vector<std::string>& getDictionary() const;
+    const std::vector<std::string_view>& getDictionary() const;
 
     /**
      * @brief Gets the current word length
@@ -80,11 +427,285 @@ public:
      */
     int getWordLength() const;
 
+    /**
+     * @brief Gets the time taken by the last dictionary load
+     * @return The wall-clock duration of the last loadDictionary call in milliseconds
+     */
+    double getLastLoadTimeMs() const;
+
+    /**
+     * @brief Gets the time taken by the last graph build
+     * @return The wall-clock duration of the last buildGraph call in milliseconds
+     */
+    double getLastBuildTimeMs() const;
+
+    /**
+     * @brief Gets the number of edges in the word graph
+     * @return The number of pairs of words one letter apart, 0 for an implicit graph
+     */
+    size_t getEdgeCount() const;
+
+    /**
+     * @brief Estimates the memory held by the game
+     * @return The bytes allocated for the dictionary, the graph and all tables derived from it
+     */
+    size_t memoryUsage() const;
+
 private:
-    Graph<std::string> wordGraph;        ///< Graph representation of word connections
-    std::vector<std::string> dictionary; ///< List of valid words
+    using WordGraph = CompactGraph<PackedWord::Key>;
+    using NodeId = WordGraph::NodeId;
+    using NeighborRange = WordGraph::NeighborRange;
+    static constexpr std::uint32_t unreachable = std::numeric_limits<std::uint32_t>::max(); ///< Distance of unreachable nodes
+    static constexpr std::uint16_t unreachableLandmark = std::numeric_limits<std::uint16_t>::max(); ///< Landmark table entry of unreachable nodes
+
+    /**
+     * @struct StoredNeighbors
+     * @brief Neighbor source reading the adjacency lists of a materialized graph
+     */
+    struct StoredNeighbors {
+        const WordGraph* graph; ///< The graph whose rows are read
+
+        /**
+         * @brief Gets the neighbors of a node
+         * @param id The node
+         * @return The node's row of the graph; the scratch buffer is not used
+         */
+        NeighborRange operator()(NodeId id, std::vector<NodeId>&) const { return graph->getNeighbors(id); }
+    };
+
+    /**
+     * @struct GeneratedNeighbors
+     * @brief Neighbor source generating the one-letter variants of a word on the fly
+     */
+    struct GeneratedNeighbors {
+        const WordLadderGame* game; ///< The game whose word table is probed
+
+        /**
+         * @brief Gets the neighbors of a node
+         * @param id The node
+         * @param scratch Receives the neighbors; the range points into it
+         * @return The neighbors present in the dictionary, sorted
+         */
+        NeighborRange operator()(NodeId id, std::vector<NodeId>& scratch) const;
+    };
+
+    /**
+     * @brief Gets the neighbors of a node from whichever source the graph uses
+     * @param id The node
+     * @param scratch Buffer for generated neighbors; the range may point into it
+     * @return The neighbors, valid until scratch is next changed
+     */
+    NeighborRange neighborsOf(NodeId id, std::vector<NodeId>& scratch) const;
+
+    /**
+     * @brief Runs the selected search strategy
+     * @param startId The starting node
+     * @param endId The target node
+     * @param context Scratch state, prepared by beginQuery; receives the path
+     * @param neighbors The neighbor source
+     * @return true if a path was found
+     */
+    template <typename Neighbors>
+    bool runSearch(NodeId startId, NodeId endId, SearchContext& context, const Neighbors& neighbors) const;
+
+    /**
+     * @brief One-directional breadth-first search
+     * @param startId The starting node
+     * @param endId The target node
+     * @param context Scratch state, prepared by beginQuery; receives the path
+     * @param neighbors The neighbor source
+     * @return true if a path was found
+     */
+    template <typename Neighbors>
+    bool findPathBreadthFirst(NodeId startId, NodeId endId, SearchContext& context, const Neighbors& neighbors) const;
+
+    /**
+     * @brief Bidirectional breadth-first search
+     * @param startId The starting node
+     * @param endId The target node
+     * @param context Scratch state, prepared by beginQuery; receives the path
+     * @param neighbors The neighbor source
+     * @return true if a path was found
+     */
+    template <typename Neighbors>
+    bool findPathBidirectional(NodeId startId, NodeId endId, SearchContext& context, const Neighbors& neighbors) const;
+
+    /**
+     * @brief Looks up the node ID of a word
+     * @param word The word to look up
+     * @return The word's node ID, or invalidNode if it is not in the dictionary
+     */
+    NodeId findNode(const std::string& word) const;
+
+    /**
+     * @brief Looks up the node ID of a packed key, including removed words
+     * @param key The packed word
+     * @return The key's node ID, or invalidNode if it never had one
+     */
+    NodeId findKey(PackedWord::Key key) const;
+
+    /**
+     * @brief Collects the dictionary words one letter away from a key
+     * @param key The packed word
+     * @param neighbors Receives the node IDs of the words, sorted
+     */
+    void collectNeighbors(PackedWord::Key key, std::vector<NodeId>& neighbors) const;
+
+    /**
+     * @brief collectNeighbors for one word length known at compile time
+     * @tparam Length The word length
+     * @param key The packed word
+     * @param neighbors Receives the node IDs of the words, sorted
+     */
+    template <size_t Length>
+    void collectNeighborsOfLength(PackedWord::Key key, std::vector<NodeId>& neighbors) const;
+
+    using NeighborCollector = void (WordLadderGame::*)(PackedWord::Key, std::vector<NodeId>&) const;
+
+    /**
+     * @brief Picks the collectNeighborsOfLength instance for a word length
+     * @param length The word length, at most PackedWord::maxLength
+     * @return The member function to call
+     */
+    static NeighborCollector neighborCollectorFor(size_t length);
+
+    /**
+     * @brief Unloads every word
+     */
+    void clearWords();
+
+    /**
+     * @brief Drops removed words and restores the sorted word table before a full build
+     */
+    void normalizeWords();
+
+    /**
+     * @brief A* search guided by landmark and Hamming lower bounds
+     * @param startId The starting node
+     * @param endId The target node
+     * @param context Scratch state, prepared by beginQuery; receives the path
+     * @param neighbors The neighbor source
+     * @return true if a path was found
+     */
+    template <typename Neighbors>
+    bool findPathLandmarkAStar(NodeId startId, NodeId endId, SearchContext& context, const Neighbors& neighbors) const;
+
+    /**
+     * @brief computeStatistics over one neighbor source
+     * @param keepDistances Whether to keep the distance matrix
+     * @param neighbors The neighbor source
+     * @return The statistics of the live words
+     */
+    template <typename Neighbors>
+    GraphStatistics computeStatisticsWith(bool keepDistances, const Neighbors& neighbors) const;
+
+    /**
+     * @brief Lower bound on the number of moves between two nodes
+     * @param from The node to measure from
+     * @param to The node to measure to
+     * @return A consistent, admissible estimate of the ladder length
+     */
+    std::uint32_t lowerBound(NodeId from, NodeId to) const;
+
+    /**
+     * @brief Rebuilds the indexes derived from a new word graph
+     */
+    void finishGraph();
+
+    /**
+     * @brief Passes a progress report to the progress callback, if any
+     * @param wordsRead Words accepted so far
+     * @param edgesFound Edges found so far
+     * @param percent Overall completion, 0 to 100
+     */
+    void reportProgress(size_t wordsRead, size_t edgesFound, int percent) const;
+
+    /**
+     * @brief Polls the cancel flag and remembers a cancellation
+     * @return true if the running load or build should stop
+     */
+    bool cancelRequested();
+
+    /**
+     * @brief Records how many words lie at each distance from a word
+     * @param source The word to search from
+     * @return The last word reached, one of the farthest from the source
+     */
+    NodeId probeLadders(NodeId source);
+
+    /**
+     * @brief Labels the connected components of the word graph
+     */
+    void indexComponents() const;
+
+    /**
+     * @brief Groups the nodes by component, renumbering components densely
+     */
+    void groupComponents() const;
+
+    /**
+     * @brief Brings the component index up to date after edits
+     */
+    void refreshComponents() const;
+
+    /**
+     * @brief Gets the representative of a component after merges
+     * @param component A component label
+     * @return The label all components merged with it resolve to
+     */
+    NodeId componentRoot(NodeId component) const;
+
+    WordGraph wordGraph;                 ///< Frozen graph of word connections, labeled by packed key; nodes only in implicit mode
+    GraphMode graphMode;                 ///< Mode used by the next build
+    bool implicitGraph;                  ///< Whether the current graph was built in implicit mode
+    PackedWordTable wordTable;           ///< Node ID of every packed word, removed ones included
+    WordArena wordText;                  ///< Text of every word, indexed by node ID
+    mutable std::vector<std::string_view> dictionary; ///< Views of the valid words in wordText, sorted; built on first use
     int currentWordLength;               ///< Length of words in current dictionary
+    std::vector<PackedWord::Key> packedWords; ///< Packed key of each word, sorted up to sortedWordCount; the index is the node ID
+    size_t sortedWordCount;              ///< Length of the sorted prefix of packedWords; later words were added by editWords
+    std::vector<bool> removedWords;      ///< Whether each node's word was removed by editWords
+    mutable bool dictionaryStale;        ///< Whether dictionary lags behind the loaded words and edits
+    PackedWord::Key packedLaneBits;      ///< PackedWord::laneLowBits of the current word length
+    NeighborCollector neighborCollector; ///< neighborCollectorFor the current word length
     mutable std::mt19937 randomEngine;   ///< Random number generator for word selection
+    double lastLoadTimeMs;               ///< Duration of the last loadDictionary call
+    double lastBuildTimeMs;              ///< Duration of the last buildGraph call
+    bool loadedFromCache;                ///< Whether the last cached load used a cache file
+    ProgressCallback progressCallback;   ///< Receiver of load and build progress
+    const std::atomic<bool>* cancelFlag; ///< Flag polled during loads and builds, may be null
+    bool cancelled;                      ///< Whether the last load or build was cancelled
+    unsigned threadCount;                ///< Threads used by buildGraph, 0 for all hardware threads
+    SearchStrategy searchStrategy;       ///< Algorithm used by findShortestPath
+    Instrumentation instrumentation;     ///< Counters of the last load, build and findShortestPath call
+    SearchContext searchContext;         ///< Scratch state reused by findShortestPath
+    mutable std::vector<NodeId> componentOf;     ///< Component ID of each node, invalidNode for removed words
+    mutable std::vector<NodeId> componentMembers; ///< Nodes grouped by component, non-trivial components first
+    mutable std::vector<NodeId> componentOffsets; ///< Start of each component in componentMembers (size components + 1)
+    mutable std::vector<NodeId> componentParent;  ///< Component each component was merged into, itself for roots
+    mutable std::vector<NodeId> componentSizes;   ///< Number of words in each root component
+    mutable size_t pairableWordCount;            ///< Length of the componentMembers prefix in non-trivial components
+    mutable bool componentsStale;        ///< Whether a removal may have split a component
+    mutable bool membersStale;           ///< Whether componentMembers lags behind edits
+    std::vector<std::uint32_t> targetDistance; ///< Distance of each node to the game target
+    std::vector<NodeId> landmarks;       ///< Landmark nodes used by the A* strategy
+    bool landmarksStale;                 ///< Whether landmarks were dropped by an edit and should be placed again
+    std::vector<std::uint16_t> landmarkDistances; ///< One distance table per landmark, landmark-major
+
+    /**
+     * @struct LadderPool
+     * @brief Probed words known to have words at one distance
+     */
+    struct LadderPool {
+        std::vector<NodeId> targets;           ///< Probed words with at least one word at this distance
+        std::vector<std::uint64_t> cumulative; ///< Running total of the targets' word counts at this distance
+    };
+
+    std::vector<LadderPool> ladderPools; ///< Ladder length index, by number of moves
+    std::vector<NodeId> probeOrder;      ///< Words in non-trivial components, shuffled; the first probeCursor are probed
+    size_t probeCursor;                  ///< Number of probed words at the front of probeOrder
+    int longestLadder;                   ///< Longest ladder found by probing, -1 before the first probe
+    int ladderBound;                     ///< No ladder has more moves; set with longestLadder
 };
 
 #endif // WORDLADDERGAME_H